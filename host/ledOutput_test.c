@@ -0,0 +1,123 @@
+/*
+ * ledOutput_test.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Host check for the LED output ramp generation (Linux port).
+ *
+ *  Description: Drives ledOutput_SetBrightness() / ledOutput_Service() and checks the
+ *  			 ramp tables handed to the stand-in PWM/DMA port (ledOutput_host.c):
+ *  			 	- a ramp starts one step away from the compare value in the PWM
+ *  			 	- entries move monotonically towards the target
+ *  			 	- the last step and the hold entry are exactly the target compare
+ *  			 	- a target posted mid-fade restarts from the mid-fade compare value,
+ *  			 	  in a different table than the one being read
+ *  			 	- no ramp is started when the target is already reached
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ledOutput.h"
+
+#define TEST_PERIOD_COUNTS		(LED_PWM_PERIOD_USEC) /* same as ledOutput_host.c */
+
+extern uint32_t ledOutputHost_lastRamp[LED_RAMP_ENTRIES];
+extern uint32_t ledOutputHost_lastRampSteps;
+extern uint32_t ledOutputHost_numberRamps;
+extern const uint32_t *ledOutputHost_activeTable;
+void ledOutputHost_RunPeriods(uint32_t periods);
+
+static uint32_t failures;
+
+#define CHECK(condition)		check((condition), #condition, __LINE__)
+
+static void check(bool condition, const char *text, int line)
+{
+	if(false == condition)
+	{
+		printf("  line %d: %s\n", line, text);
+		failures++;
+	}
+}
+
+static uint32_t expectedCompare(uint32_t brightness)
+{
+	uint32_t compare = (TEST_PERIOD_COUNTS * brightness * brightness) / (LED_BRIGHTNESS_MAX * LED_BRIGHTNESS_MAX);
+
+	return (LED_OUTPUT_ACTIVE_LOW) ? TEST_PERIOD_COUNTS - compare : compare;
+}
+
+/* checks the last ramp went from fromCompare to exactly toCompare, monotonically */
+static void checkRamp(uint32_t fromCompare, uint32_t toCompare)
+{
+	const uint32_t *ramp = ledOutputHost_lastRamp;
+	uint32_t stepSize = (uint32_t)abs((int32_t)toCompare - (int32_t)fromCompare) / LED_RAMP_STEPS + 1u;
+
+	CHECK(LED_RAMP_ENTRIES == ledOutputHost_lastRampSteps);
+	CHECK((uint32_t)abs((int32_t)ramp[0] - (int32_t)fromCompare) <= stepSize);	/* starts where the LED is */
+	CHECK(toCompare == ramp[LED_RAMP_STEPS - 1u]);									/* last step is exact */
+	CHECK(toCompare == ramp[LED_RAMP_STEPS]);										/* hold entry */
+
+	for(uint32_t index = 1; index < LED_RAMP_ENTRIES; index++)
+	{
+		if((toCompare > fromCompare) ? (ramp[index] < ramp[index - 1u]) : (ramp[index] > ramp[index - 1u]))
+		{
+			CHECK(!"ramp is not monotonic");
+			break;
+		}
+	}
+}
+
+int main(void)
+{
+	const uint32_t *firstTable;
+	uint32_t midCompare;
+
+	ledOutput_Init();
+
+	/* off -> full brightness */
+	ledOutput_SetBrightness(LED_BRIGHTNESS_MAX);
+	ledOutput_Service();
+	CHECK(1u == ledOutputHost_numberRamps);
+	checkRamp(expectedCompare(0), expectedCompare(LED_BRIGHTNESS_MAX));
+	ledOutputHost_RunPeriods(LED_RAMP_ENTRIES);
+	CHECK(expectedCompare(LED_BRIGHTNESS_MAX) == ledOutputPort_GetCompare());
+
+	/* same target again ... nothing to do */
+	ledOutput_SetBrightness(LED_BRIGHTNESS_MAX + 50u); /* clamped */
+	ledOutput_Service();
+	CHECK(1u == ledOutputHost_numberRamps);
+
+	/* full -> 30 %, retargeted to 80 % half way through the fade */
+	ledOutput_SetBrightness(30u);
+	ledOutput_Service();
+	checkRamp(expectedCompare(LED_BRIGHTNESS_MAX), expectedCompare(30u));
+	firstTable = ledOutputHost_activeTable;
+	ledOutputHost_RunPeriods(LED_RAMP_STEPS / 2u);
+	midCompare = ledOutputPort_GetCompare();
+	CHECK(midCompare != expectedCompare(LED_BRIGHTNESS_MAX) && midCompare != expectedCompare(30u));
+
+	ledOutput_SetBrightness(80u);
+	ledOutput_Service();
+	CHECK(3u == ledOutputHost_numberRamps);
+	CHECK(firstTable != ledOutputHost_activeTable); /* double buffered */
+	checkRamp(midCompare, expectedCompare(80u));
+	ledOutputHost_RunPeriods(LED_RAMP_ENTRIES);
+	CHECK(expectedCompare(80u) == ledOutputPort_GetCompare());
+	CHECK(NULL == ledOutputHost_activeTable);
+
+	/* toggle (USER_LED_TOGGLE in PWM mode) goes off, then back to full */
+	ledOutput_ToggleBrightness();
+	ledOutput_Service();
+	checkRamp(expectedCompare(80u), expectedCompare(0u));
+	ledOutputHost_RunPeriods(LED_RAMP_ENTRIES);
+	ledOutput_ToggleBrightness();
+	ledOutput_Service();
+	checkRamp(expectedCompare(0u), expectedCompare(LED_BRIGHTNESS_MAX));
+
+	printf("%s ledOutput: %u ramps, %u failed checks\n", (0u == failures) ? "PASS" : "FAIL",
+			(unsigned)ledOutputHost_numberRamps, (unsigned)failures);
+
+	return (0u == failures) ? 0 : 1;
+}
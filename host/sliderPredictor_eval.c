@@ -0,0 +1,147 @@
+/*
+ * sliderPredictor_eval.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Host replay of slider traces through the slider position predictor.
+ *
+ *  Description: Reads one or more slider traces and, for each lead from 0 to
+ *  			 EVAL_MAX_LEAD_COUNTS scans, replays every touch through sliderPredictor
+ *  			 (one sample and one prediction per scan, as processSliders() does with
+ *  			 coalescing off). The predictor's own scoring gives the average error of the
+ *  			 predicted position and of the stale (last scanned) position against the
+ *  			 sample that arrives at the target time. Use the lead with the best ratio to
+ *  			 set SLIDER_PREDICT_LEAD_MSEC in sliderPredictor.h.
+ *
+ *  			 Trace format (text, see traces/):
+ *  			 	# resolution <slider resolution>
+ *  			 	# scan_msec <scan period>
+ *  			 	<scan count> <position>		... position -1 marks a lift-off
+ *
+ *  Usage:
+ *  			sliderPredictor_eval traces/swipe.txt traces/drag.txt ...
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "sliderPredictor.h"
+
+#define EVAL_MAX_LEAD_COUNTS	(8u)
+#define EVAL_MAX_SAMPLES		(20000u)
+
+typedef struct
+{
+	uint32_t 	scan;
+	int32_t 	position;
+} traceSample_t;
+
+static traceSample_t samples[EVAL_MAX_SAMPLES];
+
+static uint32_t readTrace(const char *fileName, uint32_t *resolution, uint32_t *scanMsec)
+{
+	char line[128];
+	uint32_t numberSamples = 0;
+	FILE *file = fopen(fileName, "r");
+
+	if(NULL == file)
+	{
+		return 0;
+	}
+
+	while(NULL != fgets(line, sizeof(line), file) && numberSamples < EVAL_MAX_SAMPLES)
+	{
+		unsigned value;
+		long scan, position;
+
+		if('#' == line[0])
+		{
+			if(1 == sscanf(line, "# resolution %u", &value))
+			{
+				*resolution = value;
+			}
+			else if(1 == sscanf(line, "# scan_msec %u", &value))
+			{
+				*scanMsec = value;
+			}
+		}
+		else if(2 == sscanf(line, "%ld %ld", &scan, &position))
+		{
+			samples[numberSamples].scan = (uint32_t)scan;
+			samples[numberSamples].position = (int32_t)position;
+			numberSamples++;
+		}
+	}
+	fclose(file);
+
+	return numberSamples;
+}
+
+static void replay(uint32_t numberSamples, uint32_t leadCounts, uint32_t resolution, sliderPredictor_t *predictor)
+{
+	bool touching = false;
+
+	*predictor = (sliderPredictor_t){0};
+
+	for(uint32_t index = 0; index < numberSamples; index++)
+	{
+		if(samples[index].position < 0) /* lift-off ... no history across touches */
+		{
+			touching = false;
+			continue;
+		}
+		if(false == touching)
+		{
+			sliderPredictor_Reset(predictor);
+			touching = true;
+		}
+
+		sliderPredictor_AddSample(predictor, (uint16_t)samples[index].position, samples[index].scan);
+		(void)sliderPredictor_Predict(predictor, samples[index].scan, leadCounts, (uint16_t)resolution);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	if(argc < 2)
+	{
+		printf("usage: %s trace...\n", argv[0]);
+		return 1;
+	}
+
+	for(int arg = 1; arg < argc; arg++)
+	{
+		uint32_t resolution = 0, scanMsec = 1;
+		uint32_t numberSamples = readTrace(argv[arg], &resolution, &scanMsec);
+
+		if(0u == numberSamples || 0u == resolution)
+		{
+			printf("%s: no samples or no '# resolution' line\n", argv[arg]);
+			return 1;
+		}
+
+		printf("%s (%u samples, resolution %u, scan %u msec)\n", argv[arg],
+				(unsigned)numberSamples, (unsigned)resolution, (unsigned)scanMsec);
+		printf("  lead msec  scored  predicted err  stale err  ratio  suppressed\n");
+
+		for(uint32_t leadCounts = 0; leadCounts <= EVAL_MAX_LEAD_COUNTS; leadCounts++)
+		{
+			sliderPredictor_t predictor;
+			double predicted, stale;
+
+			replay(numberSamples, leadCounts, resolution, &predictor);
+			if(0u == predictor.evaluatedPredictions)
+			{
+				continue;
+			}
+
+			predicted = (double)predictor.predictedErrorSum / predictor.evaluatedPredictions;
+			stale = (double)predictor.staleErrorSum / predictor.evaluatedPredictions;
+			printf("  %9u  %6u  %13.2f  %9.2f  %5.2f  %10u\n", (unsigned)(leadCounts * scanMsec),
+					(unsigned)predictor.evaluatedPredictions, predicted, stale,
+					(stale > 0.0) ? predicted / stale : 0.0, (unsigned)predictor.suppressedPredictions);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * touchEventPipe_test.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Host check for the touch event pipe (Linux port).
+ *
+ *  Description: First fills the pipe from one thread to check the drop policy: hold/move
+ *  			 records stop TOUCH_EVENT_PIPE_RESERVE slots short of full, touchdown/lift-off
+ *  			 records still get in until the pipe is really full.
+ *
+ *  			 Then runs the sensing side (producer) and the application side (consumer)
+ *  			 as two threads, exactly as the split mode uses the pipe:
+ *  			 	- main thread: touchEventPipe_Init() then touchEventPipe_Connect()
+ *  			 	  (the sensing core advertises before the application core starts)
+ *  			 	- producer publishes TEST_NUMBER_RECORDS sequence-numbered records,
+ *  			 	  retrying when the pipe is full
+ *  			 	- consumer loops on touchEventPipe_Dispatch() / touchEventPipePort_Wait()
+ *  			 	  and checks every record arrives once, intact and in order
+ *
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include "touchEventPipe.h"
+
+#define TEST_NUMBER_RECORDS		(200000u)
+
+static uint32_t expectedSequence;
+static uint32_t badRecords;
+static uint32_t fullRetries;
+
+static void checkRecord(const touchEventRecord_t *record)
+{
+	if(record->value != expectedSequence
+			|| record->widget != (uint8_t)expectedSequence
+			|| record->z != (uint16_t)(expectedSequence >> 3)
+			|| record->source != TOUCH_EVENT_SOURCE_SLIDERS)
+	{
+		if(badRecords++ < 10u)
+		{
+			printf("record %u: got value %u widget %u z %u\n", (unsigned)expectedSequence,
+					(unsigned)record->value, (unsigned)record->widget, (unsigned)record->z);
+		}
+	}
+	expectedSequence = record->value + 1u; /* resynchronise so one bad record is reported once */
+}
+
+static uint32_t drainedRecords;
+static uint32_t drainedTransitions;
+
+static void countRecord(const touchEventRecord_t *record)
+{
+	/* holds were published first, the pipe must hand them back before the transitions */
+	if((drainedRecords++ < (TOUCH_EVENT_PIPE_DEPTH - TOUCH_EVENT_PIPE_RESERVE)) == (0u != record->newEvent))
+	{
+		badRecords++;
+	}
+	drainedTransitions += record->newEvent;
+}
+
+static bool checkReserve(void)
+{
+	touchEventRecord_t hold = { .source = TOUCH_EVENT_SOURCE_BUTTONS, .newEvent = 0u };
+	touchEventRecord_t transition = { .source = TOUCH_EVENT_SOURCE_BUTTONS, .newEvent = 1u };
+	uint32_t holds = 0, transitions = 0;
+
+	while(touchEventPipe_Publish(&hold) && holds <= TOUCH_EVENT_PIPE_DEPTH)
+	{
+		holds++;
+	}
+	while(touchEventPipe_Publish(&transition) && transitions <= TOUCH_EVENT_PIPE_DEPTH)
+	{
+		transitions++;
+	}
+	touchEventPipe_Dispatch(countRecord);
+
+	printf("touchEventPipe reserve: %u holds, %u transitions accepted (%u dropped)\n",
+			(unsigned)holds, (unsigned)transitions, (unsigned)touchEventPipe_GetDroppedEvents());
+
+	return (TOUCH_EVENT_PIPE_DEPTH - TOUCH_EVENT_PIPE_RESERVE == holds)
+			&& (TOUCH_EVENT_PIPE_RESERVE == transitions)
+			&& (TOUCH_EVENT_PIPE_DEPTH == drainedRecords)
+			&& (TOUCH_EVENT_PIPE_RESERVE == drainedTransitions)
+			&& (0u == badRecords);
+}
+
+static void *producerThread(void *argument)
+{
+	(void)argument;
+
+	for(uint32_t sequence = 0; sequence < TEST_NUMBER_RECORDS; sequence++)
+	{
+		touchEventRecord_t record =
+		{
+			.source = TOUCH_EVENT_SOURCE_SLIDERS,
+			.widget = (uint8_t)sequence,
+			.eventType = 1u,
+			.newEvent = 0u,
+			.value = sequence,
+			.z = (uint16_t)(sequence >> 3),
+		};
+
+		while(false == touchEventPipe_Publish(&record)) /* the sensing core would drop it ... the test wants all of them */
+		{
+			fullRetries++;
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+static void *consumerThread(void *argument)
+{
+	(void)argument;
+
+	while(expectedSequence < TEST_NUMBER_RECORDS)
+	{
+		touchEventPipe_Dispatch(checkRecord);
+		if(expectedSequence < TEST_NUMBER_RECORDS)
+		{
+			touchEventPipePort_Wait();
+		}
+	}
+
+	return NULL;
+}
+
+int main(void)
+{
+	pthread_t producer, consumer;
+	touchEventRecord_t record;
+	bool passed;
+
+	touchEventPipe_Init();
+	if(false == touchEventPipe_Connect() || false == checkReserve())
+	{
+		printf("FAIL touchEventPipe: reserve for touchdown/lift-off records\n");
+		return 1;
+	}
+
+	touchEventPipe_Init(); /* fresh ring (and dropped count) for the threaded run */
+	if(false == touchEventPipe_Connect())
+	{
+		printf("FAIL touchEventPipe: no ring advertised\n");
+		return 1;
+	}
+
+	pthread_create(&consumer, NULL, consumerThread, NULL);
+	pthread_create(&producer, NULL, producerThread, NULL);
+	pthread_join(producer, NULL);
+	pthread_join(consumer, NULL);
+
+	passed = (0u == badRecords)
+			&& (TEST_NUMBER_RECORDS == expectedSequence)
+			&& (false == touchEventPipe_Consume(&record))	/* nothing left over */
+			&& (fullRetries == touchEventPipe_GetDroppedEvents());
+
+	printf("%s touchEventPipe: %u records, %u bad, %u full (dropped count %u)\n", passed ? "PASS" : "FAIL",
+			(unsigned)expectedSequence, (unsigned)badRecords, (unsigned)fullRetries,
+			(unsigned)touchEventPipe_GetDroppedEvents());
+
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,157 @@
+/*
+ * usageTelemetry_test.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Host check for the usage telemetry persistence (Linux port).
+ *
+ *  Description: Drives usageTelemetry_Service() against the file-backed stand-in for
+ *  			 flash (usageTelemetry_file.c) and checks:
+ *  			 	- every row is written equally often (usageTelemetryHost_rowWrites[])
+ *  			 	- the newest record is restored after usageTelemetry_Init() and
+ *  			 	  writing continues in the row after it
+ *  			 	- a torn row and a row with a bad checksum are ignored (the previous
+ *  			 	  record is restored instead)
+ *  			 	- the newest record is found across a sequence number wrap-around
+ *
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "usageTelemetry.h"
+
+#define TEST_FILE				"usage_telemetry.bin"	/* same as usageTelemetry_file.c */
+#define TEST_ROW_SIZE			(512u)					/* same as usageTelemetry_file.c */
+#define TEST_ROUNDS				(3u)					/* full passes over the flash rows */
+
+extern uint32_t usageTelemetryHost_rowWrites[TELEMETRY_FLASH_SLOTS];
+
+static uint32_t failures;
+
+#define CHECK(condition)		check((condition), #condition, __LINE__)
+
+static void check(bool condition, const char *text, int line)
+{
+	if(false == condition)
+	{
+		printf("  line %d: %s\n", line, text);
+		failures++;
+	}
+}
+
+/* same as recordChecksum() in usageTelemetry.c ... the test writes its own records for the wrap-around */
+static uint32_t recordChecksum(const usageTelemetryRecord_t *record)
+{
+	const uint32_t *word = (const uint32_t *)record;
+	uint32_t sum1 = 0xFFFFu, sum2 = 0xFFFFu;
+
+	for(uint32_t index = 0; index < (offsetof(usageTelemetryRecord_t, checksum) / sizeof(uint32_t)); index++)
+	{
+		sum1 = (sum1 + word[index]) % 0xFFFFu;
+		sum2 = (sum2 + sum1) % 0xFFFFu;
+	}
+
+	return (sum2 << 16) | sum1;
+}
+
+/* one touchdown on button 0 and a flush ... the touchdown count identifies the record */
+static void flushOne(void)
+{
+	usageTelemetry_RecordButtonEvent(0, TELEMETRY_TOUCHDOWN);
+	usageTelemetry_Service(TELEMETRY_FLUSH_INTERVAL_MSEC);
+}
+
+static uint32_t restoredTouchdowns(void)
+{
+	usageTelemetry_Init();
+
+	return usageHistograms.buttonEvents[0][TELEMETRY_TOUCHDOWN];
+}
+
+/* overwrites part of a row in the "flash" file */
+static void corruptRow(uint32_t slot, uint32_t offset, uint32_t length, int fill)
+{
+	uint8_t bytes[TEST_ROW_SIZE];
+	FILE *file = fopen(TEST_FILE, "r+b");
+
+	memset(bytes, fill, sizeof(bytes));
+	if(NULL != file)
+	{
+		if(0 == fseek(file, (long)(slot * TEST_ROW_SIZE + offset), SEEK_SET))
+		{
+			(void)fwrite(bytes, 1, length, file);
+		}
+		fclose(file);
+	}
+}
+
+static void writeRecord(uint32_t slot, uint32_t sequence, uint32_t touchdowns)
+{
+	usageTelemetryRecord_t record;
+
+	memset(&record, 0, sizeof(record));
+	record.magic = TELEMETRY_RECORD_MAGIC;
+	record.sequence = sequence;
+	record.histograms.buttonEvents[0][TELEMETRY_TOUCHDOWN] = touchdowns;
+	record.checksum = recordChecksum(&record);
+	CHECK(usageTelemetryPort_StartWrite(slot, &record));
+}
+
+int main(void)
+{
+	usageTelemetryRecord_t record;
+	usageHistograms_t saved;
+	uint32_t numberFlushes = TEST_ROUNDS * TELEMETRY_FLASH_SLOTS;
+
+	remove(TEST_FILE); /* start from erased flash */
+
+	/* wear leveling ... slot n ends up holding the record with n + 1 + 2 * SLOTS touchdowns */
+	CHECK(0u == restoredTouchdowns());
+	for(uint32_t flush = 0; flush < numberFlushes; flush++)
+	{
+		flushOne();
+	}
+	for(uint32_t slot = 0; slot < TELEMETRY_FLASH_SLOTS; slot++)
+	{
+		CHECK(TEST_ROUNDS == usageTelemetryHost_rowWrites[slot]);
+	}
+	usageTelemetry_Service(TELEMETRY_FLUSH_INTERVAL_MSEC); /* nothing new ... no write */
+	CHECK(TEST_ROUNDS == usageTelemetryHost_rowWrites[0]);
+
+	/* restore the newest record, continue in the row after it */
+	saved = usageHistograms;
+	CHECK(numberFlushes == restoredTouchdowns());
+	CHECK(0 == memcmp(&saved, &usageHistograms, sizeof(saved)));
+	flushOne();
+	CHECK(1u == usageTelemetryHost_rowWrites[0]);
+	CHECK(numberFlushes + 1u == restoredTouchdowns());
+
+	/* torn write (second half of the row still erased) ... previous record wins */
+	corruptRow(0, sizeof(usageTelemetryRecord_t) / 2u, TEST_ROW_SIZE - sizeof(usageTelemetryRecord_t) / 2u, 0xFF);
+	CHECK(numberFlushes == restoredTouchdowns());
+	flushOne();
+	CHECK(1u == usageTelemetryHost_rowWrites[0]); /* the torn row is the next one written */
+
+	/* one flipped byte in the histograms ... checksum rejects it */
+	corruptRow(0, (uint32_t)offsetof(usageTelemetryRecord_t, histograms) + 8u, 1u, 0x5A);
+	CHECK(numberFlushes == restoredTouchdowns());
+
+	/* sequence wrap-around with the newest record in the first row */
+	remove(TEST_FILE);
+	writeRecord(TELEMETRY_FLASH_SLOTS - 2u, 0xFFFFFFFEu, 1u);
+	writeRecord(TELEMETRY_FLASH_SLOTS - 1u, 0xFFFFFFFFu, 2u);
+	writeRecord(0, 0u, 3u);
+	CHECK(3u == restoredTouchdowns());
+	flushOne();
+	CHECK(1u == usageTelemetryHost_rowWrites[1]);
+	CHECK(usageTelemetryPort_Read(1, &record) && 1u == record.sequence && 4u == record.histograms.buttonEvents[0][TELEMETRY_TOUCHDOWN]);
+	CHECK(4u == restoredTouchdowns());
+
+	remove(TEST_FILE);
+
+	printf("%s usageTelemetry: %u rows, %u failed checks\n", (0u == failures) ? "PASS" : "FAIL",
+			(unsigned)TELEMETRY_FLASH_SLOTS, (unsigned)failures);
+
+	return (0u == failures) ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+/*
+ * ledOutput.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  LED brightness output (PWM with DMA-fed fade).
+ *
+ *  Description: Event handlers only post a target brightness (0 - LED_BRIGHTNESS_MAX).
+ *  			 ledOutput_Service(), called from the main loop while the CapSense hardware
+ *  			 is scanning, turns the latest target into a ramp table of PWM compare
+ *  			 values and hands it to the port. The port's DMA channel writes one entry
+ *  			 into the PWM compare buffer each PWM period, so the fade itself needs no
+ *  			 CPU time at all.
+ *
+ *  			 Details:
+ *  			 	- only the most recent target is kept (posting is a single store)
+ *  			 	- a new ramp always starts from the compare value currently in the PWM,
+ *  			 	  so a target posted mid-fade continues smoothly from where the LED is
+ *  			 	- two ramp tables are used alternately so the table DMA is reading is
+ *  			 	  never rewritten
+ *  			 	- brightness is squared before scaling to the PWM period (rough
+ *  			 	  perceptual correction)
+ *  			 	- the final step is written twice (LED_RAMP_ENTRIES) so a port that swaps
+ *  			 	  compare and compare buffer every period ends with both on the target
+ *
+ *  Usage:
+ *  			- set LED_OUTPUT_PWM_ENABLE (and ramp/PWM parameters) in ledOutput.h
+ *  			- call ledOutput_Init() once instead of initializing CYBSP_USER_LED as GPIO
+ *  			- call ledOutput_SetBrightness() from event handlers (USER_LED_WRITE() and
+ *  			  USER_LED_TOGGLE() map GPIO-style on/off handlers onto full/zero brightness)
+ *  			- call ledOutput_Service() from main loop (after starting the next scan)
+ *
+ */
+
+#include "ledOutput.h"
+
+static uint32_t rampTables[2][LED_RAMP_ENTRIES];
+static uint32_t nextRampTable;
+static uint32_t pwmPeriodCounts;
+static volatile uint32_t targetBrightness;
+static volatile bool targetPending;
+
+static uint32_t brightnessToCompare(uint32_t brightness)
+{
+	uint32_t compare = (pwmPeriodCounts * brightness * brightness) / (LED_BRIGHTNESS_MAX * LED_BRIGHTNESS_MAX);
+
+#if (LED_OUTPUT_ACTIVE_LOW)
+	compare = pwmPeriodCounts - compare;
+#endif
+
+	return compare;
+}
+
+void ledOutput_Init(void)
+{
+	pwmPeriodCounts = ledOutputPort_Init();
+	targetBrightness = 0; /* port starts with the LED off */
+	targetPending = false;
+}
+
+void ledOutput_SetBrightness(uint32_t brightness)
+{
+	targetBrightness = (brightness > LED_BRIGHTNESS_MAX) ? LED_BRIGHTNESS_MAX : brightness;
+	targetPending = true;
+}
+
+void ledOutput_ToggleBrightness(void)
+{
+	ledOutput_SetBrightness((targetBrightness > 0u) ? 0u : LED_BRIGHTNESS_MAX);
+}
+
+void ledOutput_Service(void)
+{
+	uint32_t *rampTable;
+	int32_t fromCompare, toCompare;
+
+	if(false == targetPending) /* nothing new posted */
+	{
+		return;
+	}
+	targetPending = false;
+
+	fromCompare = (int32_t)ledOutputPort_GetCompare();
+	toCompare = (int32_t)brightnessToCompare(targetBrightness);
+	if(fromCompare == toCompare)
+	{
+		return;
+	}
+
+	rampTable = rampTables[nextRampTable];
+	for(uint32_t step = 1; step <= LED_RAMP_STEPS; step++) /* linear ramp, last entry is exactly the target */
+	{
+		rampTable[step - 1u] = (uint32_t)(fromCompare + ((toCompare - fromCompare) * (int32_t)step) / (int32_t)LED_RAMP_STEPS);
+	}
+	rampTable[LED_RAMP_STEPS] = (uint32_t)toCompare; /* hold entry */
+
+	ledOutputPort_StartRamp(rampTable, LED_RAMP_ENTRIES);
+	nextRampTable ^= 1u;
+}
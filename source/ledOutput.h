@@ -0,0 +1,50 @@
+/*
+ * ledOutput.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef LEDOUTPUT_H_
+#define LEDOUTPUT_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+
+/*******************************************************************************
+ * user inputs here
+ *******************************************************************************/
+/* set to 1 to drive CYBSP_USER_LED from PWM (slider sets brightness) instead of GPIO */
+#define LED_OUTPUT_PWM_ENABLE			(0u)
+/* PWM period ... one ramp step is written by DMA each period */
+#define LED_PWM_PERIOD_USEC				(1000u)
+/* number of PWM periods to fade between brightness levels (fade time = steps * period) */
+#define LED_RAMP_STEPS					(128u)
+/* CYBSP_USER_LED is on when the pin is low */
+#define LED_OUTPUT_ACTIVE_LOW			(1u)
+
+#define LED_BRIGHTNESS_MAX				(100u)
+/* ramp table length ... last step is repeated so a buffered compare (swapped every period) holds the target */
+#define LED_RAMP_ENTRIES				(LED_RAMP_STEPS + 1u)
+
+void ledOutput_Init(void);
+void ledOutput_SetBrightness(uint32_t brightness);
+void ledOutput_ToggleBrightness(void);
+void ledOutput_Service(void);
+
+/* user LED on/off from the event handlers ... pin level (MY_LED_ON/MY_LED_OFF) on GPIO,
+ * full or zero brightness when the LED is driven by PWM */
+#if (LED_OUTPUT_PWM_ENABLE)
+#define USER_LED_WRITE(level)			ledOutput_SetBrightness((((LED_OUTPUT_ACTIVE_LOW) ? 0u : 1u) == (level)) ? LED_BRIGHTNESS_MAX : 0u)
+#define USER_LED_TOGGLE()				ledOutput_ToggleBrightness()
+#else
+#define USER_LED_WRITE(level)			cyhal_gpio_write(CYBSP_USER_LED, (level))
+#define USER_LED_TOGGLE()				cyhal_gpio_toggle(CYBSP_USER_LED)
+#endif
+
+/* PWM/DMA port (ledOutput_pwm.c on PSoC 6, ledOutput_host.c on Linux) */
+uint32_t ledOutputPort_Init(void);
+uint32_t ledOutputPort_GetCompare(void);
+void ledOutputPort_StartRamp(const uint32_t *rampTable, uint32_t numberSteps);
+
+
+#endif /* LEDOUTPUT_H_ */
@@ -0,0 +1,70 @@
+/*
+ * ledOutput_host.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Linux stand-in for the LED output PWM/DMA port.
+ *
+ *  Description: Records every ramp handed to the "DMA" so the commanded fade sequence
+ *  			 can be checked off-target. Like the real DMA, the stand-in keeps a pointer
+ *  			 to the ramp table and advances through it one entry per PWM period, but
+ *  			 only when ledOutputHost_RunPeriods() is called, so a fade can be stopped
+ *  			 part way and retargeted (see host/ledOutput_test.c).
+ *
+ */
+
+#if defined(__linux__)
+
+#include <string.h>
+#include "ledOutput.h"
+
+#define LED_HOST_PERIOD_COUNTS			(LED_PWM_PERIOD_USEC) /* 1 MHz PWM clock, as on target */
+
+uint32_t ledOutputHost_lastRamp[LED_RAMP_ENTRIES];
+uint32_t ledOutputHost_lastRampSteps;
+uint32_t ledOutputHost_numberRamps;
+const uint32_t *ledOutputHost_activeTable;	/* table the "DMA" is reading, NULL when idle */
+static uint32_t activeSteps;
+static uint32_t activeIndex;
+static uint32_t hostCompare;
+
+uint32_t ledOutputPort_Init(void)
+{
+	hostCompare = (LED_OUTPUT_ACTIVE_LOW) ? LED_HOST_PERIOD_COUNTS : 0u; /* start with LED off */
+	ledOutputHost_lastRampSteps = 0;
+	ledOutputHost_numberRamps = 0;
+	ledOutputHost_activeTable = NULL;
+
+	return LED_HOST_PERIOD_COUNTS;
+}
+
+uint32_t ledOutputPort_GetCompare(void)
+{
+	return hostCompare;
+}
+
+void ledOutputPort_StartRamp(const uint32_t *rampTable, uint32_t numberSteps)
+{
+	memcpy(ledOutputHost_lastRamp, rampTable, numberSteps * sizeof(rampTable[0]));
+	ledOutputHost_lastRampSteps = numberSteps;
+	ledOutputHost_numberRamps++;
+
+	ledOutputHost_activeTable = rampTable; /* abandons the ramp in progress, compare stays where it is */
+	activeSteps = numberSteps;
+	activeIndex = 0;
+}
+
+/* advance the emulated PWM/DMA by a number of PWM periods */
+void ledOutputHost_RunPeriods(uint32_t periods)
+{
+	while(periods-- > 0u && NULL != ledOutputHost_activeTable)
+	{
+		hostCompare = ledOutputHost_activeTable[activeIndex++];
+		if(activeIndex >= activeSteps)
+		{
+			ledOutputHost_activeTable = NULL;
+		}
+	}
+}
+
+#endif /* __linux__ */
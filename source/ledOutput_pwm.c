@@ -0,0 +1,102 @@
+/*
+ * ledOutput_pwm.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  PSoC 6 port for the LED output (TCPWM PWM + DMA).
+ *
+ *  Description: pwm_led drives CYBSP_USER_LED. Its overflow (terminal count) output
+ *  			 triggers a DMA channel which copies one ramp table entry per PWM period
+ *  			 into the counter's compare buffer (CC_BUFF). Compare swap is enabled, so
+ *  			 the buffered value becomes the active compare at the next terminal count
+ *  			 and never changes mid-period (a direct CC write can glitch the output).
+ *  			 The swap also moves the old compare into the buffer every period; the
+ *  			 repeated last ramp entry (LED_RAMP_ENTRIES) leaves both registers on the
+ *  			 target so the output holds once the DMA stops.
+ *
+ *  			 Starting a new ramp aborts the one in progress. Until its first entry
+ *  			 lands, the swap may replay the previous ramp step for one period.
+ *
+ */
+
+#if !defined(__linux__)
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "ledOutput.h"
+
+cyhal_pwm_t pwm_led;
+static cyhal_dma_t ledDma;
+
+uint32_t ledOutputPort_Init(void)
+{
+	cy_rslt_t result;
+	cyhal_source_t overflowSource;
+
+	result = cyhal_pwm_init(&pwm_led, CYBSP_USER_LED, NULL);
+	if(CY_RSLT_SUCCESS == result)
+	{
+		result = cyhal_pwm_set_period(&pwm_led, LED_PWM_PERIOD_USEC, (LED_OUTPUT_ACTIVE_LOW) ? LED_PWM_PERIOD_USEC : 0u); /* start with LED off */
+	}
+	if(CY_RSLT_SUCCESS == result)
+	{
+		/* buffer starts equal to the compare so the swap is a no-op until the first ramp */
+		Cy_TCPWM_PWM_SetCompare1(pwm_led.tcpwm.base, pwm_led.tcpwm.resource.channel_num,
+				Cy_TCPWM_PWM_GetCompare0(pwm_led.tcpwm.base, pwm_led.tcpwm.resource.channel_num));
+		Cy_TCPWM_PWM_EnableCompareSwap(pwm_led.tcpwm.base, pwm_led.tcpwm.resource.channel_num, true); /* CC <-> CC_BUFF at terminal count */
+		result = cyhal_pwm_start(&pwm_led);
+	}
+	if(CY_RSLT_SUCCESS == result)
+	{
+		result = cyhal_pwm_enable_output(&pwm_led, CYHAL_PWM_OUTPUT_OVERFLOW, &overflowSource);
+	}
+	if(CY_RSLT_SUCCESS == result)
+	{
+		result = cyhal_dma_init(&ledDma, CYHAL_DMA_PRIORITY_DEFAULT, CYHAL_DMA_DIRECTION_MEM2PERIPH);
+	}
+	if(CY_RSLT_SUCCESS == result)
+	{
+		result = cyhal_dma_connect_digital(&ledDma, overflowSource, CYHAL_DMA_INPUT_TRIGGER_SINGLE_ELEMENT); /* one entry per PWM period */
+	}
+
+	CY_ASSERT(CY_RSLT_SUCCESS == result);
+
+	return Cy_TCPWM_PWM_GetPeriod0(pwm_led.tcpwm.base, pwm_led.tcpwm.resource.channel_num);
+}
+
+uint32_t ledOutputPort_GetCompare(void)
+{
+	return Cy_TCPWM_PWM_GetCompare0(pwm_led.tcpwm.base, pwm_led.tcpwm.resource.channel_num);
+}
+
+void ledOutputPort_StartRamp(const uint32_t *rampTable, uint32_t numberSteps)
+{
+	cy_rslt_t result;
+	cyhal_dma_cfg_t rampConfig =
+	{
+		.src_addr = (uint32_t)rampTable,
+		.src_increment = 1,
+		.dst_addr = (uint32_t)&TCPWM_CNT_CC_BUFF(pwm_led.tcpwm.base, pwm_led.tcpwm.resource.channel_num),
+		.dst_increment = 0,
+		.transfer_width = 32,
+		.length = numberSteps,
+		.burst_size = 1,
+		.action = CYHAL_DMA_TRANSFER_BURST
+	};
+
+	if(cyhal_dma_is_busy(&ledDma)) /* abandon the current fade ... new ramp starts from the present compare value */
+	{
+		(void)cyhal_dma_disable(&ledDma);
+	}
+
+	result = cyhal_dma_configure(&ledDma, &rampConfig);
+	if(CY_RSLT_SUCCESS == result)
+	{
+		result = cyhal_dma_enable(&ledDma); /* transfers now paced by the PWM overflow trigger */
+	}
+
+	CY_ASSERT(CY_RSLT_SUCCESS == result);
+	(void)result;
+}
+
+#endif /* !__linux__ */
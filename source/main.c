@@ -8,12 +8,26 @@
 *              processing for both buttons and sliders. Button features
 *              include placeholders to process touchdown, hold, repeat,
 *              long-hold and lift-off events. Slider features include similar
-*              touchdown, on-going and lift-off events. Refer to comments
-*              section of processButtons.c and processSliders.c for more details.
+*              touchdown, on-going and lift-off events. Touchpads (multi-touch,
+*              per-finger touchdown/move/lift-off) and matrix buttons are
+*              processed when present in the CapSense configuration. Refer to
+*              comments section of processButtons.c, processSliders.c and
+*              processTouchpads.c for more details.
 *
 *              The code example also features interfacing with Tuner GUI using
 *              I2C interface.
 *
+*              With TOUCH_PROCESSING_SPLIT_MODE enabled (touchEventPipe.h) the
+*              same source builds a sensing image for CM0+ (scanning, processing,
+*              tuner and event generation) and an application image for CM4
+*              (event handlers only). Events cross between the cores through
+*              the lock-free touch event pipe - see touchEventPipe.c.
+*              NOTE: split mode is not verified on hardware. This Makefile only
+*              builds the CM4 image; running it needs a dual-core application
+*              (a CM0+ project built from this source in place of the default
+*              CM0+ prebuilt image, which otherwise starts CM4 itself). The
+*              pipe is tested on the host only - see host/.
+*
 *              Tested on CY8CPROTO-062-4343W kit
 *
 * Related Document: See README.md
@@ -61,13 +75,30 @@
 #include "cycfg_capsense.h"
 #include "processSliders.h"
 #include "processButtons.h"
+#include "processTouchpads.h"
+#include "touchEventPipe.h"
+#include "ledOutput.h"
+#include "usageTelemetry.h"
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
+#if (CY_CPU_CORTEX_M0P)
+/* CM0+ reaches peripheral interrupts only through the NvicMux lines (mux 1 is
+ * taken by the system IPC pipe) and implements two priority bits. The EZI2C
+ * tuner is set up through the HAL, which routes its own interrupt */
+#define CAPSENSE_IRQN               (NvicMux3_IRQn)
+#define CAPSENSE_INTR_PRIORITY      (3u)
+#else
+#define CAPSENSE_IRQN               (csd_interrupt_IRQn)
 #define CAPSENSE_INTR_PRIORITY      (7u)
+#endif
 #define EZI2C_INTR_PRIORITY         (6u) /* EZI2C interrupt priority must be
                                           * higher than CapSense interrupt */
+#define APP_TIMER_INTR_PRIORITY     (7u)
+#define APP_TIMER_FREQUENCY_HZ      (10000u)
+#define APP_TIMER_PERIOD_MSEC       (1000u) /* time base tick - also wakes the
+                                             * application core when idle */
 
 /*******************************************************************************
 * Function Prototypes
@@ -76,6 +107,10 @@ static uint32_t initialize_capsense(void);
 static void initialize_capsense_tuner(void);
 static void capsense_isr(void);
 static void capsense_callback();
+#if (TOUCH_PROCESSING_SPLIT_MODE) && (CY_CPU_CORTEX_M4) && (USAGE_TELEMETRY_ENABLE)
+static void initialize_app_timer(void);
+static void app_timer_callback(void *callback_arg, cyhal_timer_event_t event);
+#endif
 void handle_error(void);
 
 /*******************************************************************************
@@ -86,6 +121,10 @@ cyhal_ezi2c_t sEzI2C;
 cyhal_ezi2c_slave_cfg_t sEzI2C_sub_cfg;
 cyhal_ezi2c_cfg_t sEzI2C_cfg;
 volatile bool capsense_scan_complete = false;
+#if (TOUCH_PROCESSING_SPLIT_MODE) && (CY_CPU_CORTEX_M4) && (USAGE_TELEMETRY_ENABLE)
+cyhal_timer_t app_timer;
+volatile uint32_t app_time_msec = 0;
+#endif
 
 /*******************************************************************************
 * Function Name: handle_error
@@ -138,7 +177,65 @@ int main(void)
     /* Enable global interrupts */
     __enable_irq();
 
+#if (TOUCH_PROCESSING_SPLIT_MODE) && (CY_CPU_CORTEX_M4)
+    /* Application core - event handlers only, touch events arrive from the
+     * sensing core through the touch event pipe.
+     */
+#if (LED_OUTPUT_PWM_ENABLE)
+    ledOutput_Init();
+#else
     cyhal_gpio_init(CYBSP_USER_LED, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, 1);
+#endif
+#if (USAGE_TELEMETRY_ENABLE)
+    uint32_t last_service_msec = 0;
+
+    usageTelemetry_Init();
+    initialize_app_timer();
+#endif
+
+    /* Ring lives in sensing core RAM - its address comes from the sensing core */
+    if (!touchEventPipe_Connect())
+    {
+        handle_error();
+    }
+
+    for (;;)
+    {
+        /* Run handlers for everything published so far, then sleep until
+         * the sensing core rings the doorbell again.
+         */
+        touchEventPipe_Dispatch(dispatch_touch_event);
+#if (LED_OUTPUT_PWM_ENABLE)
+        ledOutput_Service();
+#endif
+#if (USAGE_TELEMETRY_ENABLE)
+        /* No scans on this core - elapsed time comes from the app timer,
+         * whose tick also wakes this loop so an idle period still flushes.
+         */
+        uint32_t now_msec = app_time_msec;
+
+        usageTelemetry_Service(now_msec - last_service_msec);
+        last_service_msec = now_msec;
+#endif
+        touchEventPipePort_Wait();
+    }
+#else
+#if (TOUCH_PROCESSING_SPLIT_MODE)
+    /* Sensing core - publish events instead of running handlers. The pipe
+     * address must be advertised before the application core starts.
+     */
+    touchEventPipe_Init();
+    Cy_SysEnableCM4(CY_CORTEX_M4_APPL_ADDR);
+#else
+#if (LED_OUTPUT_PWM_ENABLE)
+    ledOutput_Init();
+#else
+    cyhal_gpio_init(CYBSP_USER_LED, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, 1);
+#endif
+#if (USAGE_TELEMETRY_ENABLE)
+    usageTelemetry_Init();
+#endif
+#endif
 
     initialize_capsense_tuner();
     result = initialize_capsense();
@@ -162,6 +259,12 @@ int main(void)
             /* Process touch input */
             processSliders();
             processButtons();
+#if defined(CY_CAPSENSE_TOUCHPAD0_WDGT_ID)
+            processTouchpads();
+#endif
+#if defined(CY_CAPSENSE_MATRIXBUTTONS0_WDGT_ID)
+            processMatrixButtons();
+#endif
 
             /* Establishes synchronized operation between the CapSense
              * middleware and the CapSense Tuner tool.
@@ -171,13 +274,134 @@ int main(void)
             /* Initiate next scan */
             Cy_CapSense_ScanAllWidgets(&cy_capsense_context);
 
+#if (LED_OUTPUT_PWM_ENABLE) && !(TOUCH_PROCESSING_SPLIT_MODE)
+            /* Start any LED fade posted by the handlers while the
+             * hardware scans - DMA runs the fade from here on.
+             */
+            ledOutput_Service();
+#endif
+
+#if (USAGE_TELEMETRY_ENABLE) && !(TOUCH_PROCESSING_SPLIT_MODE)
+            /* Deferred telemetry flush (non-blocking flash write) */
+            usageTelemetry_Service(TOUCH_COUNT_MSEC);
+#endif
+
             capsense_scan_complete = false;
         }
 
     }
+#endif
     
 }
 
+#if !(TOUCH_PROCESSING_SPLIT_MODE) || (CY_CPU_CORTEX_M4)
+/*******************************************************************************
+* Function Name: dispatch_touch_event
+********************************************************************************
+* Summary:
+*  Routes an event record to its event processing function. Called by
+*  touchEventPipe_Report() for each event in single-core mode, and for each
+*  record consumed from the pipe on the application core in split mode. Not
+*  built for the sensing core, which only publishes records.
+*
+* Parameters:
+*  touchEventRecord_t* : pointer to event record.
+*
+*******************************************************************************/
+void dispatch_touch_event(const touchEventRecord_t *record)
+{
+    switch (record->source)
+    {
+        case TOUCH_EVENT_SOURCE_BUTTONS:
+            processTouchEvents(record->eventType, record->newEvent, record->value);
+            break;
+
+        case TOUCH_EVENT_SOURCE_SLIDERS:
+            processSliderEvents(record->widget, record->eventType, record->newEvent, (uint16_t)record->value);
+            break;
+
+#if defined(CY_CAPSENSE_TOUCHPAD0_WDGT_ID)
+        case TOUCH_EVENT_SOURCE_TOUCHPADS:
+            processTouchpadEvents(record->widget, record->eventType, record->id,
+                    TOUCH_EVENT_X(record->value), TOUCH_EVENT_Y(record->value), record->z);
+            break;
+#endif
+
+#if defined(CY_CAPSENSE_MATRIXBUTTONS0_WDGT_ID)
+        case TOUCH_EVENT_SOURCE_MATRIX_BUTTONS:
+            processMatrixButtonEvents(record->widget, record->eventType, record->newEvent, record->value);
+            break;
+#endif
+
+        default:
+            break;
+    }
+}
+#endif
+
+
+#if (TOUCH_PROCESSING_SPLIT_MODE) && (CY_CPU_CORTEX_M4) && (USAGE_TELEMETRY_ENABLE)
+/*******************************************************************************
+* Function Name: initialize_app_timer
+********************************************************************************
+* Summary:
+*  Starts a periodic HAL timer on the application core. It provides the time
+*  base for usageTelemetry_Service() and wakes the core from
+*  touchEventPipePort_Wait() every APP_TIMER_PERIOD_MSEC.
+*
+*******************************************************************************/
+static void initialize_app_timer(void)
+{
+    cy_rslt_t result;
+
+    const cyhal_timer_cfg_t app_timer_cfg =
+    {
+        .compare_value = 0,
+        .period = ((APP_TIMER_FREQUENCY_HZ / 1000u) * APP_TIMER_PERIOD_MSEC) - 1u,
+        .direction = CYHAL_TIMER_DIR_UP,
+        .is_compare = false,
+        .is_continuous = true,
+        .value = 0
+    };
+
+    result = cyhal_timer_init(&app_timer, NC, NULL);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_timer_configure(&app_timer, &app_timer_cfg);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_timer_set_frequency(&app_timer, APP_TIMER_FREQUENCY_HZ);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        cyhal_timer_register_callback(&app_timer, app_timer_callback, NULL);
+        cyhal_timer_enable_event(&app_timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT, APP_TIMER_INTR_PRIORITY, true);
+        result = cyhal_timer_start(&app_timer);
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        handle_error();
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_timer_callback
+********************************************************************************
+* Summary:
+*  Advances the application core time base by one timer period.
+*
+*******************************************************************************/
+static void app_timer_callback(void *callback_arg, cyhal_timer_event_t event)
+{
+    (void)callback_arg;
+    (void)event;
+
+    app_time_msec += APP_TIMER_PERIOD_MSEC;
+}
+#endif
+
 
 /*******************************************************************************
 * Function Name: initialize_capsense
@@ -194,7 +418,10 @@ static uint32_t initialize_capsense(void)
     /* CapSense interrupt configuration parameters */
     static const cy_stc_sysint_t capSense_intr_config =
     {
-        .intrSrc = csd_interrupt_IRQn,
+        .intrSrc = CAPSENSE_IRQN,
+#if (CY_CPU_CORTEX_M0P)
+        .cm0pSrc = csd_interrupt_IRQn,
+#endif
         .intrPriority = CAPSENSE_INTR_PRIORITY,
     };
 
@@ -205,8 +432,8 @@ static uint32_t initialize_capsense(void)
         return status;
     }
 
-    /* Initialize CapSense interrupt */
-    cyhal_system_set_isr(csd_interrupt_IRQn, csd_interrupt_IRQn, CAPSENSE_INTR_PRIORITY, &capsense_isr);
+    /* Initialize CapSense interrupt (on CM0+ csd_interrupt_IRQn is the mux source) */
+    cyhal_system_set_isr(capSense_intr_config.intrSrc, csd_interrupt_IRQn, CAPSENSE_INTR_PRIORITY, &capsense_isr);
     NVIC_ClearPendingIRQ(capSense_intr_config.intrSrc);
     NVIC_EnableIRQ(capSense_intr_config.intrSrc);
 
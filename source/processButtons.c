@@ -18,7 +18,13 @@
  *  			 	- Long hold (with hysteresis) event/actions (intended for one-time event)
  *
  *  			 The primary function (processButtons) implements the following tasks:
- *  			 	- checks the status of CapSense buttons and builds a bitfield map
+ *  			 	- checks the status of CapSense buttons and debounces it
+ *  			 		- each button shifts its raw status into a 32-bit history register
+ *  			 		  every scan; it becomes active after DEBOUNCE_ON_COUNTS consecutive
+ *  			 		  active scans and inactive after DEBOUNCE_OFF_COUNTS inactive scans
+ *  			 		- cost is a shift, an OR and a mask compare per button per scan
+ *  			 		- added latency is DEBOUNCE_ON/OFF_LATENCY_MSEC (see buttonDebounceStats)
+ *  			 	- builds a bitfield map of debounced buttons
  *  			 	- analyzes the resulting bitfield for active buttons or lift-off events
  *  			 	- determines if an active button is the result of a new (i.e. touchdown)
  *  			 	  event, a hold (i.e. on-going) event or encountered a lift-off event
@@ -40,9 +46,21 @@
  *  				- note - these names are used as limits in the for() loop
  *  			- enter total CapSense scan time in TOUCH_COUNT_MSEC macro (processButtons.h)
  *  			- enter desired hold and repeat rate parameters in processButtons.h
+ *  			- enter desired debounce on/off times in processButtons.h (check rejectedGlitches
+ *  			  in buttonDebounceStats while tuning ... 0 msec disables debounce)
  *  			- copy/paste (or delete) template handler to add (or remove) additional buttons
  *  			- add action code to desired events
+ *  			- usage telemetry (USAGE_TELEMETRY_ENABLE in usageTelemetry.h) counts touchdowns
+ *  			  and touch durations through TELEMETRY_BUTTON_TOUCH() in processTouchEvents(),
+ *  			  hold/repeat/long-hold events through TELEMETRY_BUTTON_EVENT() in each handler
+ *  			  and matrix button touchdowns through TELEMETRY_MATRIX_BUTTON()
  *  			- call processButtons() from main loop when CapSense engine is not busy
+ *  			- matrix buttons (if configured) are handled by processMatrixButtons(), which
+ *  			  reports touchdown, hold and lift-off per button number (row * columns + column
+ *  			  for CSD sensing, the sensor index for CSX sensing)
+ *  			- in split mode (TOUCH_PROCESSING_SPLIT_MODE in touchEventPipe.h) processButtons()
+ *  			  runs on the sensing core and processTouchEvents() runs on the application
+ *  			  core from the touch event pipe (see touchEventPipe.c)
  *
  */
 
@@ -50,47 +68,98 @@
 #include "cybsp.h"
 #include "cycfg_capsense.h"
 #include "processButtons.h"
+#include "touchEventPipe.h"
+#include "usageTelemetry.h"
+#include "ledOutput.h"
 
-uint32_t processButtons(void)
+/* history is one uint32_t per widget ... shift by 32 (a 0 mask) is undefined, 0 counts would never activate */
+_Static_assert(DEBOUNCE_ON_COUNTS >= 1u && DEBOUNCE_ON_COUNTS <= 32u, "DEBOUNCE_ON_COUNTS must be 1 to 32 (check DEBOUNCE_ON_TIME_MSEC)");
+_Static_assert(DEBOUNCE_OFF_COUNTS >= 1u && DEBOUNCE_OFF_COUNTS <= 32u, "DEBOUNCE_OFF_COUNTS must be 1 to 32 (check DEBOUNCE_OFF_TIME_MSEC)");
+
+buttonDebounceStats_t buttonDebounceStats =
 {
-    static uint32_t previousBitField;
-    uint32_t wdgtBitfield, numWdgtActive;
+	.onLatencyMsec = DEBOUNCE_ON_LATENCY_MSEC,
+	.offLatencyMsec = DEBOUNCE_OFF_LATENCY_MSEC,
+	.rejectedGlitches = 0
+};
 
-	wdgtBitfield = NO_WIDGETS_ACTIVE; /* initialize bitfield */
+/* returns debounced active-button bitfield (bit 0 = Button0) and number of debounced active buttons */
+static uint32_t debounceButtons(uint32_t *numWdgtActive)
+{
+	static uint32_t debounceHistory[Button1 - Button0 + 1]; /* newest raw status in bit 0 */
+	static uint32_t debouncedBitfield;
+	bool anyWidgetActive = Cy_CapSense_IsAnyWidgetActive(&cy_capsense_context); /* skip per-widget checks if nothing is active */
 
-    if(Cy_CapSense_IsAnyWidgetActive(&cy_capsense_context)) /* skip if no widgets are active */
-    {
-		/* look for key presses */
-		numWdgtActive = 0;
+	*numWdgtActive = 0;
 
-		/* build active widget bitfield */
-		for(uint32_t wdgtIndex = Button0; wdgtIndex <= Button1; wdgtIndex++)
+	for(uint32_t wdgtIndex = Button0; wdgtIndex <= Button1; wdgtIndex++)
+	{
+		uint32_t wdgtBit = 1u << (wdgtIndex - Button0);
+		uint32_t history = debounceHistory[wdgtIndex - Button0] << 1;
+
+		if(anyWidgetActive && Cy_CapSense_IsWidgetActive(wdgtIndex, &cy_capsense_context))
 		{
-			if(Cy_CapSense_IsWidgetActive(wdgtIndex, &cy_capsense_context)) /* look for active widgets */
+			history |= 1u;
+		}
+		debounceHistory[wdgtIndex - Button0] = history;
+
+		if(0 != (debouncedBitfield & wdgtBit)) /* debounced active ... look for OFF_COUNTS inactive scans */
+		{
+			if(0 == (history & DEBOUNCE_OFF_MASK))
 			{
-				wdgtBitfield |= 1 << (wdgtIndex - Button0); /* build active bitfield */
-				numWdgtActive++;
+				debouncedBitfield &= ~wdgtBit;
+			}
+			else if(0x1u == (history & 0x3u)) /* short inactive run ended ... glitch rejected */
+			{
+				buttonDebounceStats.rejectedGlitches++;
 			}
 		}
-		if(wdgtBitfield > 0) /* at least one key is active */
+		else /* debounced inactive ... look for ON_COUNTS active scans */
 		{
-			if(previousBitField != wdgtBitfield) /* this is a new (touchdown) event */
+			if(DEBOUNCE_ON_MASK == (history & DEBOUNCE_ON_MASK))
 			{
-				previousBitField = wdgtBitfield;
-				processTouchEvents(numWdgtActive, true, wdgtBitfield); /* process new touchdown event */
+				debouncedBitfield |= wdgtBit;
 			}
-			else /* this is a hold event */
+			else if(0x2u == (history & 0x3u)) /* short active run ended ... glitch rejected */
 			{
-				processTouchEvents(1, false, previousBitField); /* not a new event, process hold */
+				buttonDebounceStats.rejectedGlitches++;
 			}
 		}
-    }
-	else /* no widgets are active */
+
+		if(0 != (debouncedBitfield & wdgtBit))
+		{
+			(*numWdgtActive)++;
+		}
+	}
+
+	return debouncedBitfield;
+}
+
+uint32_t processButtons(void)
+{
+    static uint32_t previousBitField;
+    uint32_t wdgtBitfield, numWdgtActive;
+
+	wdgtBitfield = debounceButtons(&numWdgtActive); /* build debounced active widget bitfield */
+
+	if(wdgtBitfield > 0) /* at least one key is active */
+	{
+		if(previousBitField != wdgtBitfield) /* this is a new (touchdown) event */
+		{
+			previousBitField = wdgtBitfield;
+			touchEventPipe_Report(TOUCH_EVENT_SOURCE_BUTTONS, 0, numWdgtActive, true, wdgtBitfield, 0, 0); /* process new touchdown event */
+		}
+		else /* this is a hold event */
+		{
+			touchEventPipe_Report(TOUCH_EVENT_SOURCE_BUTTONS, 0, 1, false, previousBitField, 0, 0); /* not a new event, process hold */
+		}
+	}
+	else /* no buttons are active */
 	{
 		/* check buttons to see if they went inactive on this scan */
 		if(0 != previousBitField) /* this is a new liftoff event */
 		{
-			processTouchEvents(NO_WIDGETS_ACTIVE, true, previousBitField); /* report and process lift-off event */
+			touchEventPipe_Report(TOUCH_EVENT_SOURCE_BUTTONS, 0, NO_WIDGETS_ACTIVE, true, previousBitField, 0, 0); /* report and process lift-off event */
 			previousBitField = 0;
 		}
 	}
@@ -100,6 +169,8 @@ uint32_t processButtons(void)
 
 void processTouchEvents(uint32_t numberActiveWidgets, bool newEvent, uint32_t bitFieldActiveButtons)
 {
+	TELEMETRY_BUTTON_TOUCH(numberActiveWidgets, newEvent, bitFieldActiveButtons); /* touchdown count and touch duration */
+
 	if(numberActiveWidgets <= 1) /* only process single key presses or liftoff events (0 active widgets) */
 	{
 		switch(bitFieldActiveButtons)
@@ -140,7 +211,7 @@ void btn_Button0(uint32_t eventType, bool newEvent)
 			longHoldExpired = false;
 
 			/* do any touchdown actions here */
-			cyhal_gpio_write(CYBSP_USER_LED, MY_LED_ON);
+			USER_LED_WRITE(MY_LED_ON);
 
 		}
 		else /* ongoing touch event */
@@ -157,7 +228,8 @@ void btn_Button0(uint32_t eventType, bool newEvent)
 					repeatCount = 0; /* initialize repeat counter */
 
 					/* do any short hold actions here (will only happen once until button is released) */
-					cyhal_gpio_write(CYBSP_USER_LED, MY_LED_OFF);
+					TELEMETRY_BUTTON_EVENT(Button0 - Button0, TELEMETRY_SHORT_HOLD);
+					USER_LED_WRITE(MY_LED_OFF);
 
 				}
 				else /* execute "repeat" actions every TOUCH_REPEAT_COUNTS interval */
@@ -167,7 +239,8 @@ void btn_Button0(uint32_t eventType, bool newEvent)
 						repeatCount = 0; /* reset repeat counter */
 
 						/* do any repeat actions here */
-						cyhal_gpio_toggle(CYBSP_USER_LED);
+						TELEMETRY_BUTTON_EVENT(Button0 - Button0, TELEMETRY_REPEAT);
+						USER_LED_TOGGLE();
 					}
 				}
 			}
@@ -179,14 +252,15 @@ void btn_Button0(uint32_t eventType, bool newEvent)
 				longHoldExpired = true; /* set flag */
 
 				/* do any long-hold actions here */
-				cyhal_gpio_write(CYBSP_USER_LED, MY_LED_OFF);
+				TELEMETRY_BUTTON_EVENT(Button0 - Button0, TELEMETRY_LONG_HOLD);
+				USER_LED_WRITE(MY_LED_OFF);
 			}
 		}
 	}
 	else if(LIFT_OFF == eventType) /* number of active widgets is 0 */
 	{
 		/* do any lift-off actions here */
-		cyhal_gpio_write(CYBSP_USER_LED, MY_LED_OFF);
+		USER_LED_WRITE(MY_LED_OFF);
 	}
 }
 
@@ -206,7 +280,7 @@ void btn_Button1(uint32_t eventType, bool newEvent)
 			longHoldExpired = false;
 
 			/* do any touchdown actions here */
-			cyhal_gpio_write(CYBSP_USER_LED, MY_LED_ON);
+			USER_LED_WRITE(MY_LED_ON);
 
 		}
 		else /* ongoing touch event */
@@ -223,7 +297,8 @@ void btn_Button1(uint32_t eventType, bool newEvent)
 					repeatCount = 0; /* initialize repeat counter */
 
 					/* do any short hold actions here (will only happen once until button is released) */
-					cyhal_gpio_write(CYBSP_USER_LED, MY_LED_OFF);
+					TELEMETRY_BUTTON_EVENT(Button1 - Button0, TELEMETRY_SHORT_HOLD);
+					USER_LED_WRITE(MY_LED_OFF);
 
 				}
 				else /* execute "repeat" actions every TOUCH_REPEAT_COUNTS interval */
@@ -233,7 +308,8 @@ void btn_Button1(uint32_t eventType, bool newEvent)
 						repeatCount = 0; /* reset repeat counter */
 
 						/* do any repeat actions here */
-						cyhal_gpio_toggle(CYBSP_USER_LED);
+						TELEMETRY_BUTTON_EVENT(Button1 - Button0, TELEMETRY_REPEAT);
+						USER_LED_TOGGLE();
 					}
 				}
 			}
@@ -245,15 +321,112 @@ void btn_Button1(uint32_t eventType, bool newEvent)
 				longHoldExpired = true; /* set flag */
 
 				/* do any long-hold actions here */
-				cyhal_gpio_write(CYBSP_USER_LED, MY_LED_OFF);
+				TELEMETRY_BUTTON_EVENT(Button1 - Button0, TELEMETRY_LONG_HOLD);
+				USER_LED_WRITE(MY_LED_OFF);
 			}
 		}
 	}
 	else if(LIFT_OFF == eventType) /* number of active widgets is 0 */
 	{
 		/* do any lift-off actions here */
-		cyhal_gpio_write(CYBSP_USER_LED, MY_LED_OFF);
+		USER_LED_WRITE(MY_LED_OFF);
+	}
+}
+
+#if defined(CY_CAPSENSE_MATRIXBUTTONS0_WDGT_ID)
+
+uint32_t processMatrixButtons(void)
+{
+	static uint32_t previousButton[NUMBER_OF_MATRIX_BUTTONS]; /* active button number + 1 ... 0 when no button is active */
+	cy_stc_capsense_touch_t *ptrTouch;
+	uint32_t numMatrixActive = 0;
+
+	for(uint32_t wdgtIndex = MatrixButtons0; wdgtIndex <= MatrixButtons0; wdgtIndex++)
+	{
+		uint32_t *previous = &previousButton[wdgtIndex - MatrixButtons0];
+
+		if(Cy_CapSense_IsWidgetActive(wdgtIndex, &cy_capsense_context))
+		{
+			uint32_t buttonNum = 0;
+
+			if(CY_CAPSENSE_CSD_GROUP == cy_capsense_context.ptrWdConfig[wdgtIndex].senseMethod)
+			{
+				/* button number comes from the CSD matrix position (x = active column, y = active row) */
+				ptrTouch = Cy_CapSense_GetTouchInfo(wdgtIndex, &cy_capsense_context);
+				buttonNum = (ptrTouch->ptrPosition->y * cy_capsense_context.ptrWdConfig[wdgtIndex].numCols) + ptrTouch->ptrPosition->x;
+			}
+			else
+			{
+				/* CSX matrix buttons have no position ... every node is its own sensor, the
+				 * first active sensor index is the button number */
+				while((buttonNum < (cy_capsense_context.ptrWdConfig[wdgtIndex].numSns - 1u))
+						&& (0u == Cy_CapSense_IsSensorActive(wdgtIndex, buttonNum, &cy_capsense_context)))
+				{
+					buttonNum++;
+				}
+			}
+
+			numMatrixActive++;
+
+			if(*previous != buttonNum + 1u) /* this is a new (touchdown) event */
+			{
+				if(0 != *previous) /* slid straight onto another button ... lift the old one first */
+				{
+					touchEventPipe_Report(TOUCH_EVENT_SOURCE_MATRIX_BUTTONS, wdgtIndex, LIFT_OFF, true, *previous - 1u, 0, 0);
+				}
+				*previous = buttonNum + 1u;
+				touchEventPipe_Report(TOUCH_EVENT_SOURCE_MATRIX_BUTTONS, wdgtIndex, TOUCH_ACTIVE, true, buttonNum, 0, 0);
+			}
+			else /* this is a hold event */
+			{
+				touchEventPipe_Report(TOUCH_EVENT_SOURCE_MATRIX_BUTTONS, wdgtIndex, TOUCH_ACTIVE, false, buttonNum, 0, 0);
+			}
+		}
+		else if(0 != *previous) /* this is a new lift-off event */
+		{
+			touchEventPipe_Report(TOUCH_EVENT_SOURCE_MATRIX_BUTTONS, wdgtIndex, LIFT_OFF, true, *previous - 1u, 0, 0);
+			*previous = 0;
+		}
 	}
+
+	return numMatrixActive;
 }
 
+void processMatrixButtonEvents(uint32_t matrixNum, uint32_t eventType, bool newEvent, uint32_t buttonNum)
+{
+	if(TOUCH_ACTIVE == eventType && true == newEvent) /* key usage (usage telemetry) */
+	{
+		TELEMETRY_MATRIX_BUTTON(buttonNum);
+	}
+
+	switch(matrixNum)
+	{
+		case MatrixButtons0:
+			matrix_0(eventType, newEvent, buttonNum);
+			break;
+
+		default:
+			break;
+	}
+}
+
+void matrix_0(uint32_t eventType, bool newEvent, uint32_t buttonNum)
+{
+	if(TOUCH_ACTIVE == eventType)
+	{
+		if(true == newEvent) /* touchdown actions here (use buttonNum to select the key) */
+		{
+			USER_LED_WRITE(MY_LED_ON);
+		}
+		else /* on-going actions here (will happen each scan) */
+		{
+
+		}
+	}
+	else if(LIFT_OFF == eventType) /* lift-off actions here */
+	{
+		USER_LED_WRITE(MY_LED_OFF);
+	}
+}
 
+#endif /* CY_CAPSENSE_MATRIXBUTTONS0_WDGT_ID */
@@ -27,6 +27,9 @@
 #define LONG_HOLD_TIME_MSEC			(5000u)
 /* define long hold time hysteresis */
 #define LONG_HOLD_TIME_HYST_MSEC	(10000u)
+/* define debounce - time a button must read active (inactive) before touchdown (lift-off) is reported */
+#define DEBOUNCE_ON_TIME_MSEC		(3u)
+#define DEBOUNCE_OFF_TIME_MSEC		(3u)
 
 /*******************************************************************************
  * pre-processor macros for calculating hold and repeat counts
@@ -38,6 +41,18 @@
 #define LONG_HOLD_TIME_COUNTS		(LONG_HOLD_TIME_MSEC / TOUCH_COUNT_MSEC)
 #define LONG_HOLD_HYSTERESIS_COUNTS	(LONG_HOLD_TIME_HYST_MSEC / TOUCH_COUNT_MSEC)
 
+/*******************************************************************************
+ * pre-processor macros for debounce (consecutive scans, 1 to 32 - 1 means no debounce)
+ *  - note - DEBOUNCE_xx_COUNTS can be entered directly instead of in msec
+ ********************************************************************************/
+#define DEBOUNCE_ON_COUNTS			(((DEBOUNCE_ON_TIME_MSEC + TOUCH_COUNT_MSEC - 1u) / TOUCH_COUNT_MSEC) ? ((DEBOUNCE_ON_TIME_MSEC + TOUCH_COUNT_MSEC - 1u) / TOUCH_COUNT_MSEC) : 1u)
+#define DEBOUNCE_OFF_COUNTS			(((DEBOUNCE_OFF_TIME_MSEC + TOUCH_COUNT_MSEC - 1u) / TOUCH_COUNT_MSEC) ? ((DEBOUNCE_OFF_TIME_MSEC + TOUCH_COUNT_MSEC - 1u) / TOUCH_COUNT_MSEC) : 1u)
+#define DEBOUNCE_ON_MASK			(0xFFFFFFFFu >> (32u - DEBOUNCE_ON_COUNTS))
+#define DEBOUNCE_OFF_MASK			(0xFFFFFFFFu >> (32u - DEBOUNCE_OFF_COUNTS))
+/* latency added by debounce on top of CapSense processing (touchdown and lift-off are each delayed by this much) */
+#define DEBOUNCE_ON_LATENCY_MSEC	((DEBOUNCE_ON_COUNTS - 1u) * TOUCH_COUNT_MSEC)
+#define DEBOUNCE_OFF_LATENCY_MSEC	((DEBOUNCE_OFF_COUNTS - 1u) * TOUCH_COUNT_MSEC)
+
 #define MY_LED_OFF					(1u)
 #define MY_LED_ON					(0u)
 
@@ -47,11 +62,34 @@ enum {
 	Button1 = CY_CAPSENSE_BUTTON1_WDGT_ID
 };
 
+typedef struct
+{
+	uint32_t 	onLatencyMsec;		/* DEBOUNCE_ON_LATENCY_MSEC */
+	uint32_t 	offLatencyMsec;		/* DEBOUNCE_OFF_LATENCY_MSEC */
+	uint32_t 	rejectedGlitches;	/* raw status changes that reverted before reaching the threshold */
+} buttonDebounceStats_t;
+
+extern buttonDebounceStats_t buttonDebounceStats;
+
 uint32_t processButtons(void);
 void processTouchEvents(uint32_t numberActiveWidgets, bool newEvent, uint32_t bitFieldActiveButtons);
 
 void btn_Button0(uint32_t eventType, bool newEvent);
 void btn_Button1(uint32_t eventType, bool newEvent);
 
+/* matrix buttons (only built when the CapSense configuration has a matrix button widget) */
+#if defined(CY_CAPSENSE_MATRIXBUTTONS0_WDGT_ID)
+#define NUMBER_OF_MATRIX_BUTTONS	(1u)
+
+enum {
+	MatrixButtons0 = CY_CAPSENSE_MATRIXBUTTONS0_WDGT_ID
+};
+
+uint32_t processMatrixButtons(void);
+void processMatrixButtonEvents(uint32_t matrixNum, uint32_t eventType, bool newEvent, uint32_t buttonNum);
+
+void matrix_0(uint32_t eventType, bool newEvent, uint32_t buttonNum);
+#endif
+
 
 #endif /* PROCESSBUTTONS_H_ */
@@ -19,10 +19,20 @@
  *  			 The primary function (processSliders) implements the following tasks:
  *  			 	- checks for previously active slider and updates position
  *  			 		- does nothing until there is a change in position (or lift-off occurs)
+ *  			 		- coalesces small/fast moves: a move is only reported once the position
+ *  			 		  has changed by minMoveDelta AND minMoveIntervalCounts scans have passed
+ *  			 		  since the last reported event (absorbed changes are counted in
+ *  			 		  coalescedEvents, reported ones in deliveredEvents)
+ *  			 		- once the finger comes to rest short of minMoveDelta (position unchanged
+ *  			 		  for settleCounts scans), the residual is delivered as one settle move
  *  			 	- searches for active slider (if none are previously active)
  *  			 	- reports touchdown event for newly active slider
  *  			 	- updates touch status (true/false) in sliderValues array
+ *  			 	- optionally reports an extrapolated position in move events (see sliderPredictor.c)
+ *  			 		- previousSliderValue holds the position actually delivered, so a predicted
+ *  			 		  overshoot is corrected by a true-position move at rest or at lift-off
  *  			 	- identifies and reports lift-off events
+ *  			 		- a coalesced final position is always reported as a move before lift-off
  *
  *  			The secondary function (processSliderEvents) calls the appropriate slider
  *  			event handler via simple switch() statement. TODO - replace with a
@@ -34,17 +44,39 @@
  *  Usage:
  *  			- include processSliders.h file in main.c (#include "processSliders.h")
  *  			- add descriptive slider names to enum in processSliders.h file
+ *  			- set SLIDER_MIN_MOVE_DELTA, SLIDER_MIN_MOVE_INTERVAL_MSEC and SLIDER_SETTLE_TIME_MSEC
+ *  			  in processSliders.h (or per slider in sliderCoalesceConfig[]) ... 0 and 0 for
+ *  			  delta and interval report every change
  *  			- add event actions in placeholder sections of the template code
  *  			- call processSliders() from main loop when CapSense engine is not busy
+ *  			- in split mode (TOUCH_PROCESSING_SPLIT_MODE in touchEventPipe.h) processSliders()
+ *  			  runs on the sensing core and processSliderEvents() runs on the application
+ *  			  core from the touch event pipe (see touchEventPipe.c)
  *
  */
 
 #include "cyhal.h"
 #include "cybsp.h"
 #include "cycfg_capsense.h"
+#include "processButtons.h"
 #include "processSliders.h"
+#include "touchEventPipe.h"
+#include "sliderPredictor.h"
+#include "ledOutput.h"
+#include "usageTelemetry.h"
 
 sliderValues_t sliderValues[NUMBER_OF_SLIDERS];
+sliderPredictor_t sliderPredictors[NUMBER_OF_SLIDERS];
+
+/* per-slider coalescing limits ... add an entry for each slider */
+sliderCoalesceConfig_t sliderCoalesceConfig[NUMBER_OF_SLIDERS] =
+{
+	{ .minMoveDelta = SLIDER_MIN_MOVE_DELTA, .minMoveIntervalCounts = SLIDER_MIN_MOVE_INTERVAL_COUNTS, .settleCounts = SLIDER_SETTLE_COUNTS }
+};
+
+_Static_assert(SLIDER_SETTLE_COUNTS >= 1u, "SLIDER_SETTLE_TIME_MSEC must be at least one scan (TOUCH_COUNT_MSEC)");
+
+static void coalesceSliderMove(uint32_t sliderNum, uint32_t scanCounter);
 
 uint32_t processSliders(void)
 {
@@ -63,10 +95,19 @@ uint32_t processSliders(void)
 			ptrTouch = Cy_CapSense_GetTouchInfo(activeSlider, &cy_capsense_context); /* use pointer to get slider data */
 			sliderValues[activeSlider - Slider0].currentSliderValue = ptrTouch->ptrPosition->x; /* get slider centroid/position */
 			sliderValues[activeSlider - Slider0].lastUpdateCounterValue = capsenseScanCounter; /* update scan counter (future use) */
+#if (SLIDER_PREDICTION_ENABLE)
+			sliderPredictor_AddSample(&sliderPredictors[activeSlider - Slider0], sliderValues[activeSlider - Slider0].currentSliderValue, capsenseScanCounter);
+#endif
+
+			if(sliderValues[activeSlider - Slider0].lastScannedValue != sliderValues[activeSlider - Slider0].currentSliderValue) /* position changed on this scan ... not at rest */
+			{
+				sliderValues[activeSlider - Slider0].lastScannedValue = sliderValues[activeSlider - Slider0].currentSliderValue;
+				sliderValues[activeSlider - Slider0].lastMoveCounterValue = capsenseScanCounter;
+			}
 
-			if(sliderValues[activeSlider - Slider0].previousSliderValue != sliderValues[activeSlider - Slider0].currentSliderValue) /* only process changes in position */
+			if(sliderValues[activeSlider - Slider0].previousSliderValue != sliderValues[activeSlider - Slider0].currentSliderValue) /* differs from last reported position ... move or settle */
 			{
-				processSliderEvents(activeSlider, false, sliderValues[activeSlider - Slider0].currentSliderValue);
+				coalesceSliderMove(activeSlider, capsenseScanCounter);
 			}
 		}
 		else /* no sliders currently active ... look for active slider */
@@ -83,7 +124,15 @@ uint32_t processSliders(void)
 					{
 						sliderValues[wdgtIndex - Slider0].touchStatus = true;
 						sliderValues[wdgtIndex - Slider0].previousSliderValue = sliderValues[wdgtIndex - Slider0].currentSliderValue;
-						processSliderEvents(wdgtIndex, true, sliderValues[activeSlider - Slider0].currentSliderValue);
+						sliderValues[wdgtIndex - Slider0].lastScannedValue = sliderValues[wdgtIndex - Slider0].currentSliderValue;
+						sliderValues[wdgtIndex - Slider0].lastMoveCounterValue = capsenseScanCounter;
+						sliderValues[wdgtIndex - Slider0].lastReportCounterValue = capsenseScanCounter;
+						sliderValues[wdgtIndex - Slider0].deliveredEvents++;
+#if (SLIDER_PREDICTION_ENABLE)
+						sliderPredictor_Reset(&sliderPredictors[wdgtIndex - Slider0]); /* no history across touches */
+						sliderPredictor_AddSample(&sliderPredictors[wdgtIndex - Slider0], sliderValues[wdgtIndex - Slider0].currentSliderValue, capsenseScanCounter);
+#endif
+						touchEventPipe_Report(TOUCH_EVENT_SOURCE_SLIDERS, wdgtIndex, SLIDER_ACTIVE, true, sliderValues[wdgtIndex - Slider0].currentSliderValue, 0, 0);
 					}
 
 					activeSlider = wdgtIndex; /* prioritize active slider ... save the index (first-come, first-serve) */
@@ -106,8 +155,16 @@ uint32_t processSliders(void)
 			{
 				if(true == sliderValues[wdgtIndex - Slider0].touchStatus) /* this is a new lift-off event */
 				{
+					if(sliderValues[wdgtIndex - Slider0].previousSliderValue != sliderValues[wdgtIndex - Slider0].currentSliderValue) /* final position was coalesced ... deliver it */
+					{
+						sliderValues[wdgtIndex - Slider0].previousSliderValue = sliderValues[wdgtIndex - Slider0].currentSliderValue;
+						sliderValues[wdgtIndex - Slider0].deliveredEvents++;
+						touchEventPipe_Report(TOUCH_EVENT_SOURCE_SLIDERS, wdgtIndex, SLIDER_ACTIVE, false, sliderValues[wdgtIndex - Slider0].currentSliderValue, 0, 0);
+					}
+
 					sliderValues[wdgtIndex - Slider0].touchStatus = false; /* mark slider inactive */
-					processSliderEvents(wdgtIndex, true, sliderValues[activeSlider - Slider0].currentSliderValue);
+					sliderValues[wdgtIndex - Slider0].deliveredEvents++;
+					touchEventPipe_Report(TOUCH_EVENT_SOURCE_SLIDERS, wdgtIndex, SLIDER_LIFT_OFF, true, sliderValues[wdgtIndex - Slider0].currentSliderValue, 0, 0);
 					break;
 				}
 			}
@@ -120,12 +177,53 @@ uint32_t processSliders(void)
 }
 
 
-void processSliderEvents(uint32_t sliderNum, bool newEvent, uint16_t sliderValue)
+/* reports a move only when it is late enough since the last reported event AND either far enough
+ * or the finger has come to rest (settle ... a residual below minMoveDelta is never left behind).
+ * A settle makes the reported position equal the scanned one, so there is at most one per rest. */
+static void coalesceSliderMove(uint32_t sliderNum, uint32_t scanCounter)
+{
+	sliderValues_t *slider = &sliderValues[sliderNum - Slider0];
+	const sliderCoalesceConfig_t *config = &sliderCoalesceConfig[sliderNum - Slider0];
+	uint32_t delta = (slider->currentSliderValue > slider->previousSliderValue) ?
+			(uint32_t)(slider->currentSliderValue - slider->previousSliderValue) :
+			(uint32_t)(slider->previousSliderValue - slider->currentSliderValue);
+	bool moved = (slider->lastMoveCounterValue == scanCounter); /* position changed on this scan */
+	bool atRest = ((scanCounter - slider->lastMoveCounterValue) >= config->settleCounts);
+
+	if((scanCounter - slider->lastReportCounterValue) >= config->minMoveIntervalCounts
+			&& (delta >= config->minMoveDelta || true == atRest))
+	{
+		uint16_t reportValue = slider->currentSliderValue;
+
+#if (SLIDER_PREDICTION_ENABLE)
+		if(true == moved) /* extrapolate only while moving ... a settle move delivers the true position */
+		{
+			reportValue = sliderPredictor_Predict(&sliderPredictors[sliderNum - Slider0], scanCounter,
+					SLIDER_PREDICT_LEAD_MSEC / TOUCH_COUNT_MSEC, cy_capsense_context.ptrWdConfig[sliderNum].xResolution);
+		}
+#endif
+		slider->previousSliderValue = reportValue; /* remember what the handler got (may be predicted) */
+		slider->lastReportCounterValue = scanCounter;
+		slider->deliveredEvents++;
+		touchEventPipe_Report(TOUCH_EVENT_SOURCE_SLIDERS, sliderNum, SLIDER_ACTIVE, false, reportValue, 0, 0);
+	}
+	else if(true == moved) /* absorbed ... previousSliderValue keeps the last reported position so small moves accumulate */
+	{
+		slider->coalescedEvents++;
+	}
+}
+
+void processSliderEvents(uint32_t sliderNum, uint32_t eventType, bool newEvent, uint16_t sliderValue)
 {
+	if(SLIDER_ACTIVE == eventType) /* position distribution (usage telemetry) */
+	{
+		TELEMETRY_SLIDER_POSITION(sliderNum - Slider0, sliderValue, cy_capsense_context.ptrWdConfig[sliderNum].xResolution);
+	}
+
 	switch(sliderNum)
 	{
 		case Slider0:
-			slider_0(newEvent, sliderValue);
+			slider_0(eventType, newEvent, sliderValue);
 			break;
 
 		default:
@@ -134,26 +232,42 @@ void processSliderEvents(uint32_t sliderNum, bool newEvent, uint16_t sliderValue
 }
 
 
-void slider_0(bool newEvent, uint16_t sliderValue)
+/* NOTE - besides their arguments (and their own statics), processSliderEvents() and slider_0() read the
+ * slider resolution from cy_capsense_context.ptrWdConfig. In split mode that is the application core
+ * image's copy of the static widget configuration, so both images must be built from the same
+ * CapSense configuration. */
+
+void slider_0(uint32_t eventType, bool newEvent, uint16_t sliderValue)
 {
-	if(true == sliderValues[Slider0 - Slider0].touchStatus)
+	static uint16_t effectStartValue;
+
+	if(SLIDER_ACTIVE == eventType)
 	{
+#if (LED_OUTPUT_PWM_ENABLE)
+		/* touchdown and ongoing actions - slider position sets LED brightness (fade runs in hardware) */
+		ledOutput_SetBrightness((sliderValue * LED_BRIGHTNESS_MAX) / cy_capsense_context.ptrWdConfig[Slider0].xResolution);
+		(void)newEvent;
+		(void)effectStartValue;
+#else
 		if(true == newEvent) /* touchdown actions here */
 		{
+			effectStartValue = sliderValue;
 			cyhal_gpio_write(CYBSP_USER_LED, 0);
 		}
 		else /* ongoing actions here */
 		{
-			if(sliderValues[Slider0 - Slider0].currentSliderValue - sliderValues[Slider0 - Slider0].previousSliderValue > 25) /* arbitrary demo effect */
+			if(sliderValue - effectStartValue > 25) /* arbitrary demo effect */
 			{
 				cyhal_gpio_toggle(CYBSP_USER_LED); /* arbitrary effect */
-				sliderValues[Slider0 - Slider0].previousSliderValue = sliderValues[Slider0 - Slider0].currentSliderValue; /* update previous value to current value */
+				effectStartValue = sliderValue; /* restart effect from current position */
 			}
 		}
+#endif
 	}
 	else /* lift-off actions here */
 	{
+#if !(LED_OUTPUT_PWM_ENABLE) /* with PWM output the LED keeps the brightness set by the slider */
 		cyhal_gpio_write(CYBSP_USER_LED, 1);
+#endif
 	}
 }
-
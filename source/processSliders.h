@@ -13,6 +13,23 @@
 
 #define NUMBER_OF_SLIDERS				(1u)
 #define NO_SLIDERS_ACTIVE				(0xFFFF)
+#define SLIDER_ACTIVE					(1u)
+#define SLIDER_LIFT_OFF					(0u)
+
+/*******************************************************************************
+ * user inputs here (slider move coalescing - defaults for every slider, see sliderCoalesceConfig[])
+ *  - scan time comes from TOUCH_COUNT_MSEC in processButtons.h
+ *******************************************************************************/
+/* smallest change in position reported as a move (smaller changes are coalesced) */
+#define SLIDER_MIN_MOVE_DELTA			(4u)
+/* minimum time between move events (e.g. 20 msec for at most 50 moves per second) */
+#define SLIDER_MIN_MOVE_INTERVAL_MSEC	(20u)
+/* time the position must stay unchanged before the finger counts as at rest and a residual
+ * below SLIDER_MIN_MOVE_DELTA is delivered (keep it longer than the scan-to-scan jitter lasts) */
+#define SLIDER_SETTLE_TIME_MSEC			(40u)
+
+#define SLIDER_MIN_MOVE_INTERVAL_COUNTS	(SLIDER_MIN_MOVE_INTERVAL_MSEC / TOUCH_COUNT_MSEC)
+#define SLIDER_SETTLE_COUNTS			(SLIDER_SETTLE_TIME_MSEC / TOUCH_COUNT_MSEC)
 
 /* enumeration for sliders */
 enum {
@@ -22,15 +39,30 @@ enum {
 typedef struct
 {
 	uint16_t 	currentSliderValue;
-	uint16_t 	previousSliderValue;
+	uint16_t 	previousSliderValue;		/* last reported position (predicted value if prediction is on) */
+	uint16_t 	lastScannedValue;			/* position on the previous scan (detects rest) */
 	uint32_t 	lastUpdateCounterValue;
+	uint32_t 	lastMoveCounterValue;		/* scan count of last position change */
+	uint32_t 	lastReportCounterValue;		/* scan count of last reported event */
+	uint32_t 	deliveredEvents;			/* events passed to the handler */
+	uint32_t 	coalescedEvents;			/* scans whose position change was absorbed by coalescing */
 	bool 		touchStatus;
 } sliderValues_t;
 
+typedef struct
+{
+	uint16_t 	minMoveDelta;
+	uint16_t 	minMoveIntervalCounts;
+	uint16_t 	settleCounts;				/* unchanged scans before a residual is delivered (at least 1) */
+} sliderCoalesceConfig_t;
+
+extern sliderValues_t sliderValues[NUMBER_OF_SLIDERS];
+extern sliderCoalesceConfig_t sliderCoalesceConfig[NUMBER_OF_SLIDERS];
+
 uint32_t processSliders(void);
-void processSliderEvents(uint32_t sliderNum, bool newEvent, uint16_t sliderValue);
+void processSliderEvents(uint32_t sliderNum, uint32_t eventType, bool newEvent, uint16_t sliderValue);
 
-void slider_0(bool newEvent, uint16_t sliderValue);
+void slider_0(uint32_t eventType, bool newEvent, uint16_t sliderValue);
 
 
 #endif /* PROCESSSLIDERS_H_ */
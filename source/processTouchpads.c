@@ -0,0 +1,235 @@
+/*
+ * processTouchpads.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Shell/template for processing CapSense touchpads and handling associated events.
+ *
+ *  Description: This file contains code for processing multi-touch CapSense touchpads
+ *  			 and handling associated per-finger events.
+ *
+ *  			 It identifies and provides the following features and event placeholders:
+ *  			 	- Consumes every reported position (ptrPosition[0..numPosition-1], x/y/z)
+ *  			 	- Assigns a stable finger ID that follows each touch across scans
+ *  			 	- Distinguishes between touchdown, move and lift-off events per finger
+ *
+ *  			 The primary function (processTouchpads) implements the following tasks:
+ *  			 	- reads touch info for each touchpad
+ *  			 	- matches new positions to tracked fingers with a greedy nearest-neighbor
+ *  			 	  assignment (|dx| + |dy| distance, gated by TOUCHPAD_MAX_MOVE_DISTANCE)
+ *  			 	- reports lift-off for tracked fingers that were not matched
+ *  			 	- reports move for matched fingers whose position changed
+ *  			 	- reports touchdown (with a new finger ID) for unmatched positions
+ *
+ *  			 Cost per scan is bounded by TOUCHPAD_MAX_FINGERS (at most
+ *  			 TOUCHPAD_MAX_FINGERS^3 distance checks - 27 for 3 fingers) and does not
+ *  			 depend on touchpad resolution or sensor count.
+ *
+ *  			The secondary function (processTouchpadEvents) calls the appropriate touchpad
+ *  			event handler via simple switch() statement.
+ *
+ *  			Finally, the touchpad event handler provides placeholders for touchdown, move
+ *  			and lift-off event actions.
+ *
+ *  Usage:
+ *  			- include processTouchpads.h file in main.c (#include "processTouchpads.h")
+ *  			- add descriptive touchpad names to enum in processTouchpads.h file
+ *  			- set TOUCHPAD_MAX_MOVE_DISTANCE for the touchpad resolution and scan rate
+ *  			- add event actions in placeholder sections of the template code
+ *  			- usage telemetry (USAGE_TELEMETRY_ENABLE in usageTelemetry.h) counts touchdown
+ *  			  positions and fingers down through TELEMETRY_TOUCHPAD_FINGER()
+ *  			- call processTouchpads() from main loop when CapSense engine is not busy
+ *
+ */
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cycfg_capsense.h"
+
+#if defined(CY_CAPSENSE_TOUCHPAD0_WDGT_ID) /* only built when the CapSense configuration has a touchpad */
+
+#include "processButtons.h"
+#include "processTouchpads.h"
+#include "touchEventPipe.h"
+#include "ledOutput.h"
+#include "usageTelemetry.h"
+
+touchpadValues_t touchpadValues[NUMBER_OF_TOUCHPADS];
+
+static void trackFingers(uint32_t touchpadNum, const cy_stc_capsense_touch_t *ptrTouch);
+
+uint32_t processTouchpads(void)
+{
+	uint32_t status = 0;
+	static uint32_t capsenseScanCounter = 0;
+	cy_stc_capsense_touch_t *ptrTouch;
+
+	capsenseScanCounter++; /* elapsed time counter ... future use */
+
+	for(uint32_t wdgtIndex = Touchpad0; wdgtIndex <= Touchpad0; wdgtIndex++)
+	{
+		ptrTouch = Cy_CapSense_GetTouchInfo(wdgtIndex, &cy_capsense_context); /* use pointer to get touchpad data */
+
+		if(ptrTouch->numPosition > TOUCHPAD_MAX_FINGERS) /* more touches than can be resolved ... hold current state */
+		{
+			continue;
+		}
+
+		trackFingers(wdgtIndex, ptrTouch);
+		touchpadValues[wdgtIndex - Touchpad0].lastUpdateCounterValue = capsenseScanCounter; /* update scan counter (future use) */
+	}
+
+	return status;
+}
+
+static void trackFingers(uint32_t touchpadNum, const cy_stc_capsense_touch_t *ptrTouch)
+{
+	touchpadValues_t *touchpad = &touchpadValues[touchpadNum - Touchpad0];
+	uint32_t numPositions = ptrTouch->numPosition;
+	bool fingerMatched[TOUCHPAD_MAX_FINGERS] = {false};
+	bool positionMatched[TOUCHPAD_MAX_FINGERS] = {false};
+	uint8_t matchedPosition[TOUCHPAD_MAX_FINGERS];
+
+	/* greedy nearest-neighbor ... each pass takes the closest remaining (finger, position) pair */
+	for(uint32_t pass = 0; pass < TOUCHPAD_MAX_FINGERS; pass++)
+	{
+		uint32_t bestDistance = TOUCHPAD_MAX_MOVE_DISTANCE + 1u;
+		uint32_t bestFinger = 0, bestPosition = 0;
+
+		for(uint32_t fingerIndex = 0; fingerIndex < TOUCHPAD_MAX_FINGERS; fingerIndex++)
+		{
+			if(false == touchpad->fingers[fingerIndex].touchStatus || true == fingerMatched[fingerIndex])
+			{
+				continue;
+			}
+
+			for(uint32_t posIndex = 0; posIndex < numPositions; posIndex++)
+			{
+				if(true == positionMatched[posIndex])
+				{
+					continue;
+				}
+
+				int32_t dx = (int32_t)ptrTouch->ptrPosition[posIndex].x - (int32_t)touchpad->fingers[fingerIndex].x;
+				int32_t dy = (int32_t)ptrTouch->ptrPosition[posIndex].y - (int32_t)touchpad->fingers[fingerIndex].y;
+				uint32_t distance = (uint32_t)((dx < 0) ? -dx : dx) + (uint32_t)((dy < 0) ? -dy : dy);
+
+				if(distance < bestDistance)
+				{
+					bestDistance = distance;
+					bestFinger = fingerIndex;
+					bestPosition = posIndex;
+				}
+			}
+		}
+
+		if(bestDistance > TOUCHPAD_MAX_MOVE_DISTANCE) /* nothing left within reach */
+		{
+			break;
+		}
+
+		fingerMatched[bestFinger] = true;
+		positionMatched[bestPosition] = true;
+		matchedPosition[bestFinger] = (uint8_t)bestPosition;
+	}
+
+	/* lift-off first so a freed slot can be reused by a touchdown on this same scan */
+	for(uint32_t fingerIndex = 0; fingerIndex < TOUCHPAD_MAX_FINGERS; fingerIndex++)
+	{
+		touchpadFinger_t *finger = &touchpad->fingers[fingerIndex];
+
+		if(true == finger->touchStatus && false == fingerMatched[fingerIndex]) /* this is a new lift-off event */
+		{
+			finger->touchStatus = false;
+			touchEventPipe_Report(TOUCH_EVENT_SOURCE_TOUCHPADS, touchpadNum, TOUCHPAD_LIFT_OFF, true, TOUCH_EVENT_XY(finger->x, finger->y), finger->z, finger->id);
+		}
+	}
+
+	for(uint32_t fingerIndex = 0; fingerIndex < TOUCHPAD_MAX_FINGERS; fingerIndex++)
+	{
+		touchpadFinger_t *finger = &touchpad->fingers[fingerIndex];
+
+		if(true == fingerMatched[fingerIndex])
+		{
+			const cy_stc_capsense_position_t *position = &ptrTouch->ptrPosition[matchedPosition[fingerIndex]];
+
+			finger->z = position->z;
+			if(position->x != finger->x || position->y != finger->y) /* only process changes in position */
+			{
+				finger->x = position->x;
+				finger->y = position->y;
+				touchEventPipe_Report(TOUCH_EVENT_SOURCE_TOUCHPADS, touchpadNum, TOUCHPAD_MOVE, false, TOUCH_EVENT_XY(finger->x, finger->y), finger->z, finger->id);
+			}
+		}
+	}
+
+	for(uint32_t posIndex = 0; posIndex < numPositions; posIndex++)
+	{
+		if(true == positionMatched[posIndex])
+		{
+			continue;
+		}
+
+		for(uint32_t fingerIndex = 0; fingerIndex < TOUCHPAD_MAX_FINGERS; fingerIndex++)
+		{
+			touchpadFinger_t *finger = &touchpad->fingers[fingerIndex];
+
+			if(false == finger->touchStatus) /* free slot ... this is a new touchdown event */
+			{
+				finger->x = ptrTouch->ptrPosition[posIndex].x;
+				finger->y = ptrTouch->ptrPosition[posIndex].y;
+				finger->z = ptrTouch->ptrPosition[posIndex].z;
+				finger->id = touchpad->nextFingerId;
+				finger->touchStatus = true;
+
+				touchpad->nextFingerId = (NO_FINGER_ID - 1u == touchpad->nextFingerId) ? 0 : touchpad->nextFingerId + 1u; /* never hand out NO_FINGER_ID */
+
+				touchEventPipe_Report(TOUCH_EVENT_SOURCE_TOUCHPADS, touchpadNum, TOUCHPAD_TOUCHDOWN, true, TOUCH_EVENT_XY(finger->x, finger->y), finger->z, finger->id);
+				break;
+			}
+		}
+	}
+}
+
+void processTouchpadEvents(uint32_t touchpadNum, uint32_t eventType, uint32_t fingerId, uint16_t x, uint16_t y, uint16_t z)
+{
+	if(TOUCHPAD_MOVE != eventType) /* touchdown position and fingers down (usage telemetry) */
+	{
+		/* resolution comes from the static widget configuration ... the application core image's copy in split mode */
+		TELEMETRY_TOUCHPAD_FINGER(touchpadNum - Touchpad0, TOUCHPAD_TOUCHDOWN == eventType, x, y,
+				cy_capsense_context.ptrWdConfig[touchpadNum].xResolution, cy_capsense_context.ptrWdConfig[touchpadNum].yResolution);
+	}
+
+	switch(touchpadNum)
+	{
+		case Touchpad0:
+			touchpad_0(eventType, fingerId, x, y, z);
+			break;
+
+		default:
+			break;
+	}
+}
+
+
+void touchpad_0(uint32_t eventType, uint32_t fingerId, uint16_t x, uint16_t y, uint16_t z)
+{
+	switch(eventType)
+	{
+		case TOUCHPAD_TOUCHDOWN: /* touchdown actions here (once per finger) */
+			USER_LED_WRITE(MY_LED_ON);
+			break;
+
+		case TOUCHPAD_MOVE: /* move actions here (only when this finger's position changes) */
+			break;
+
+		case TOUCHPAD_LIFT_OFF: /* lift-off actions here (once per finger) */
+			USER_LED_WRITE(MY_LED_OFF);
+			break;
+
+		default:
+			break;
+	}
+}
+
+#endif /* CY_CAPSENSE_TOUCHPAD0_WDGT_ID */
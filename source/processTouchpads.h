@@ -0,0 +1,64 @@
+/*
+ * processTouchpads.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef PROCESSTOUCHPADS_H_
+#define PROCESSTOUCHPADS_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "cycfg_capsense.h"
+
+/* only used when the CapSense configuration has a touchpad */
+#if defined(CY_CAPSENSE_TOUCHPAD0_WDGT_ID)
+
+#define NUMBER_OF_TOUCHPADS				(1u)
+#define NO_FINGER_ID					(0xFFu)
+
+/*******************************************************************************
+ * user inputs here
+ *******************************************************************************/
+/* maximum simultaneous fingers tracked per touchpad (CapSense reports up to 3 centroids) */
+#define TOUCHPAD_MAX_FINGERS			(3u)
+/* largest |dx| + |dy| (in touchpad resolution units) between scans still treated as the same finger */
+#define TOUCHPAD_MAX_MOVE_DISTANCE		(200u)
+
+/* touchpad finger events */
+enum {
+	TOUCHPAD_LIFT_OFF = 0,
+	TOUCHPAD_TOUCHDOWN,
+	TOUCHPAD_MOVE
+};
+
+/* enumeration for touchpads */
+enum {
+	Touchpad0 = CY_CAPSENSE_TOUCHPAD0_WDGT_ID
+};
+
+typedef struct
+{
+	uint16_t 	x;
+	uint16_t 	y;
+	uint16_t 	z;
+	uint8_t 	id;			/* stable ID for the life of the touch */
+	bool 		touchStatus;
+} touchpadFinger_t;
+
+typedef struct
+{
+	touchpadFinger_t 	fingers[TOUCHPAD_MAX_FINGERS];
+	uint8_t 			nextFingerId;
+	uint32_t 			lastUpdateCounterValue;
+} touchpadValues_t;
+
+uint32_t processTouchpads(void);
+void processTouchpadEvents(uint32_t touchpadNum, uint32_t eventType, uint32_t fingerId, uint16_t x, uint16_t y, uint16_t z);
+
+void touchpad_0(uint32_t eventType, uint32_t fingerId, uint16_t x, uint16_t y, uint16_t z);
+
+#endif /* CY_CAPSENSE_TOUCHPAD0_WDGT_ID */
+
+
+#endif /* PROCESSTOUCHPADS_H_ */
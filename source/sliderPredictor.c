@@ -0,0 +1,132 @@
+/*
+ * sliderPredictor.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Slider position predictor (hides scan-to-handler latency).
+ *
+ *  Description: By the time a slider handler runs, the scanned position is already at
+ *  			 least one scan period old. This file extrapolates the position forward
+ *  			 from the last SLIDER_PREDICTOR_SAMPLES timestamped samples:
+ *
+ *  			 	predicted = newest + (newest - oldest) * horizon / (t_newest - t_oldest)
+ *
+ *  			 where horizon is the time since the newest sample plus the configured lead.
+ *
+ *  			 Safeguards:
+ *  			 	- result is clamped to 0..resolution of the slider
+ *  			 	- no extrapolation while the finger reverses direction inside the sample
+ *  			 	  window (the newest sample is returned unmodified)
+ *  			 	- no extrapolation until two samples with different timestamps exist
+ *
+ *  			 Evaluation: each prediction is kept until a sample arrives at (or after) its
+ *  			 target time and is then scored against it. predictedErrorSum / staleErrorSum
+ *  			 over evaluatedPredictions give the average error with and without prediction,
+ *  			 i.e. how much of the latency the predictor hides and what it costs in
+ *  			 overshoot. The file has no CapSense/HAL dependencies so recorded traces can be
+ *  			 replayed through it off-target (host/sliderPredictor_eval.c).
+ *
+ *  Usage:
+ *  			- set SLIDER_PREDICTION_ENABLE and SLIDER_PREDICT_LEAD_MSEC in sliderPredictor.h
+ *  			- processSliders() feeds one sample per scan and reports predicted positions
+ *  			  in move events; touchdown, lift-off, settle and final positions stay unpredicted
+ *  			- read sliderPredictors[] (processSliders.c) to tune the lead, or replay traces
+ *  			  with host/sliderPredictor_eval over a range of leads
+ *
+ */
+
+#include "sliderPredictor.h"
+
+static uint32_t absoluteDifference(int32_t a, int32_t b)
+{
+	return (a > b) ? (uint32_t)(a - b) : (uint32_t)(b - a);
+}
+
+void sliderPredictor_Reset(sliderPredictor_t *predictor)
+{
+	predictor->numberSamples = 0;
+	predictor->newest = 0;
+	predictor->pendingValid = false; /* evaluation totals are kept across touches */
+}
+
+void sliderPredictor_AddSample(sliderPredictor_t *predictor, uint16_t position, uint32_t timestamp)
+{
+	if(true == predictor->pendingValid && (int32_t)(timestamp - predictor->pendingTarget) >= 0) /* score prediction made for this time */
+	{
+		predictor->predictedErrorSum += absoluteDifference(predictor->pendingPredicted, position);
+		predictor->staleErrorSum += absoluteDifference(predictor->pendingStale, position);
+		predictor->evaluatedPredictions++;
+		predictor->pendingValid = false;
+	}
+
+	if(predictor->numberSamples > 0)
+	{
+		predictor->newest = (uint8_t)((predictor->newest + 1u) % SLIDER_PREDICTOR_SAMPLES);
+	}
+	if(predictor->numberSamples < SLIDER_PREDICTOR_SAMPLES)
+	{
+		predictor->numberSamples++;
+	}
+
+	predictor->position[predictor->newest] = position;
+	predictor->timestamp[predictor->newest] = timestamp;
+}
+
+uint16_t sliderPredictor_Predict(sliderPredictor_t *predictor, uint32_t now, uint32_t leadCounts, uint16_t resolution)
+{
+	uint32_t newest = predictor->newest;
+	uint32_t oldest = (newest + SLIDER_PREDICTOR_SAMPLES + 1u - predictor->numberSamples) % SLIDER_PREDICTOR_SAMPLES;
+	uint16_t newestPosition = predictor->position[newest];
+	uint32_t elapsed, horizon;
+	int32_t distance, predicted;
+	bool movingUp = false, movingDown = false;
+
+	if(predictor->numberSamples < 2u)
+	{
+		return newestPosition;
+	}
+
+	elapsed = predictor->timestamp[newest] - predictor->timestamp[oldest];
+	if(0u == elapsed)
+	{
+		return newestPosition;
+	}
+
+	/* look for a reversal anywhere in the window */
+	for(uint32_t index = oldest; index != newest; index = (index + 1u) % SLIDER_PREDICTOR_SAMPLES)
+	{
+		uint16_t from = predictor->position[index];
+		uint16_t to = predictor->position[(index + 1u) % SLIDER_PREDICTOR_SAMPLES];
+
+		movingUp |= (to > from);
+		movingDown |= (to < from);
+	}
+	if(movingUp && movingDown)
+	{
+		predictor->suppressedPredictions++;
+		return newestPosition;
+	}
+
+	distance = (int32_t)newestPosition - (int32_t)predictor->position[oldest];
+	horizon = (now - predictor->timestamp[newest]) + leadCounts;
+	predicted = (int32_t)newestPosition + (distance * (int32_t)horizon) / (int32_t)elapsed;
+
+	if(predicted < 0)
+	{
+		predicted = 0;
+	}
+	else if(predicted > (int32_t)resolution)
+	{
+		predicted = (int32_t)resolution;
+	}
+
+	if(false == predictor->pendingValid) /* keep the outstanding prediction until it is scored (lead may span several scans) */
+	{
+		predictor->pendingValid = true;
+		predictor->pendingTarget = now + leadCounts;
+		predictor->pendingPredicted = (uint16_t)predicted;
+		predictor->pendingStale = newestPosition;
+	}
+
+	return (uint16_t)predicted;
+}
@@ -0,0 +1,46 @@
+/*
+ * sliderPredictor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef SLIDERPREDICTOR_H_
+#define SLIDERPREDICTOR_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+
+/*******************************************************************************
+ * user inputs here
+ *******************************************************************************/
+/* set to 1 to report extrapolated (instead of last scanned) position in slider move events */
+#define SLIDER_PREDICTION_ENABLE		(0u)
+/* number of recent samples used to estimate velocity */
+#define SLIDER_PREDICTOR_SAMPLES		(4u)
+/* how far ahead to extrapolate - one scan period for the serialized main loop, two if the handler runs a scan later */
+#define SLIDER_PREDICT_LEAD_MSEC		(1u)
+
+typedef struct
+{
+	uint16_t 	position[SLIDER_PREDICTOR_SAMPLES];
+	uint32_t 	timestamp[SLIDER_PREDICTOR_SAMPLES];	/* scan counts */
+	uint8_t 	numberSamples;
+	uint8_t 	newest;
+
+	/* evaluation ... each prediction is scored against the sample that arrives at its target time */
+	bool 		pendingValid;
+	uint32_t 	pendingTarget;
+	uint16_t 	pendingPredicted;
+	uint16_t 	pendingStale;
+	uint32_t 	evaluatedPredictions;
+	uint32_t 	predictedErrorSum;		/* sum of |predicted - actual| */
+	uint32_t 	staleErrorSum;			/* sum of |last scanned - actual| ... error without prediction */
+	uint32_t 	suppressedPredictions;	/* predictions skipped on direction reversal */
+} sliderPredictor_t;
+
+void sliderPredictor_Reset(sliderPredictor_t *predictor);
+void sliderPredictor_AddSample(sliderPredictor_t *predictor, uint16_t position, uint32_t timestamp);
+uint16_t sliderPredictor_Predict(sliderPredictor_t *predictor, uint32_t now, uint32_t leadCounts, uint16_t resolution);
+
+
+#endif /* SLIDERPREDICTOR_H_ */
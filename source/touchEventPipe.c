@@ -0,0 +1,131 @@
+/*
+ * touchEventPipe.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Event pipe between the sensing core and the application core.
+ *
+ *  Description: This file contains a lock-free, single-producer/single-consumer ring
+ *  			 of compact touch event records which both cores can access.
+ *
+ *  			 When TOUCH_PROCESSING_SPLIT_MODE is enabled, the sensing core owns CSD
+ *  			 scanning, Cy_CapSense_ProcessAllWidgets(), processButtons() and
+ *  			 processSliders(). Instead of calling the event handlers directly, it
+ *  			 publishes one record per event into the pipe and notifies the application
+ *  			 core. The application core drains the pipe and calls processTouchEvents()
+ *  			 and processSliderEvents() exactly as the single-core loop would.
+ *
+ *  			 The two cores are linked as separate images, so a symbol in one image does
+ *  			 not resolve to the same address in the other. The ring is therefore
+ *  			 ordinary RAM of the sensing core and touchEventPipe_Init() hands its address
+ *  			 to the application core through the port; touchEventPipe_Connect() picks
+ *  			 it up on the other side.
+ *
+ *  			 Neither side ever blocks on the other:
+ *  			 	- the producer drops (and counts) records if the pipe is full ... hold
+ *  			 	  and move records are dropped first, the last TOUCH_EVENT_PIPE_RESERVE
+ *  			 	  slots only take touchdown/lift-off records (newEvent set)
+ *  			 	- the consumer only reads what has already been published
+ *
+ *  			 Address hand-off and notification are handled by a small transport port so
+ *  			 the pipe itself has no hardware dependencies:
+ *  			 	- touchEventPipe_ipc.c   - PSoC 6 IPC channel data + interrupt (CM0+ -> CM4)
+ *  			 	- touchEventPipe_posix.c - shared variable + condition variable (two threads on Linux)
+ *
+ *  			 NOTE: the PSoC 6 port has not been run on hardware - this example's
+ *  			 Makefile only builds the CM4 image (see main.c). The ring and the Linux
+ *  			 port are exercised by host/touchEventPipe_test.c.
+ *
+ *  Usage:
+ *  			- set TOUCH_PROCESSING_SPLIT_MODE to 1 in touchEventPipe.h
+ *  			- sensing core calls touchEventPipe_Init() before the application core is
+ *  			  started
+ *  			- application core calls touchEventPipe_Connect(), then loops on
+ *  			  touchEventPipe_Dispatch() followed by touchEventPipePort_Wait()
+ *  			- size TOUCH_EVENT_PIPE_DEPTH for the worst-case number of scans the
+ *  			  application core can fall behind (check touchEventPipe_GetDroppedEvents()
+ *  			  while tuning)
+ *
+ */
+
+#include <stddef.h>
+#include "touchEventPipe.h"
+
+_Static_assert((TOUCH_EVENT_PIPE_DEPTH & TOUCH_EVENT_PIPE_MASK) == 0u, "TOUCH_EVENT_PIPE_DEPTH must be a power of 2");
+_Static_assert(TOUCH_EVENT_PIPE_RESERVE < TOUCH_EVENT_PIPE_DEPTH, "TOUCH_EVENT_PIPE_RESERVE must leave room for hold/move records");
+
+static touchEventPipe_t touchEventPipeStorage;	/* owned by the sensing core */
+static touchEventPipe_t *pipe;					/* ring in use on this core */
+
+void touchEventPipe_Init(void)
+{
+	pipe = &touchEventPipeStorage;
+
+	atomic_store_explicit(&pipe->head, 0u, memory_order_relaxed);
+	atomic_store_explicit(&pipe->tail, 0u, memory_order_relaxed);
+	pipe->droppedEvents = 0;
+
+	touchEventPipePort_Advertise(pipe); /* must happen before the application core starts */
+}
+
+bool touchEventPipe_Connect(void)
+{
+	pipe = touchEventPipePort_Connect();
+
+	return (NULL != pipe);
+}
+
+bool touchEventPipe_Publish(const touchEventRecord_t *record)
+{
+	uint32_t head = atomic_load_explicit(&pipe->head, memory_order_relaxed);
+	uint32_t tail = atomic_load_explicit(&pipe->tail, memory_order_acquire); /* consumer has finished reading up to tail */
+	uint32_t limit = (0u != record->newEvent) ? TOUCH_EVENT_PIPE_DEPTH : (TOUCH_EVENT_PIPE_DEPTH - TOUCH_EVENT_PIPE_RESERVE);
+
+	if((head - tail) >= limit) /* pipe is full (for this kind of record) ... never wait on the consumer */
+	{
+		pipe->droppedEvents++;
+		return false;
+	}
+
+	pipe->records[head & TOUCH_EVENT_PIPE_MASK] = *record;
+	atomic_store_explicit(&pipe->head, head + 1u, memory_order_release); /* make record visible before the new head */
+
+	touchEventPipePort_Notify();
+
+	return true;
+}
+
+bool touchEventPipe_Consume(touchEventRecord_t *record)
+{
+	uint32_t tail = atomic_load_explicit(&pipe->tail, memory_order_relaxed);
+	uint32_t head = atomic_load_explicit(&pipe->head, memory_order_acquire); /* producer has finished writing up to head */
+
+	if(head == tail) /* pipe is empty */
+	{
+		return false;
+	}
+
+	*record = pipe->records[tail & TOUCH_EVENT_PIPE_MASK];
+	atomic_store_explicit(&pipe->tail, tail + 1u, memory_order_release); /* hand the slot back to the producer */
+
+	return true;
+}
+
+uint32_t touchEventPipe_Dispatch(touchEventHandler_t handler)
+{
+	touchEventRecord_t record;
+	uint32_t numberDispatched = 0;
+
+	while(touchEventPipe_Consume(&record)) /* drain everything published so far, in order */
+	{
+		handler(&record);
+		numberDispatched++;
+	}
+
+	return numberDispatched;
+}
+
+uint32_t touchEventPipe_GetDroppedEvents(void)
+{
+	return (NULL != pipe) ? pipe->droppedEvents : 0u;
+}
@@ -0,0 +1,105 @@
+/*
+ * touchEventPipe.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef TOUCHEVENTPIPE_H_
+#define TOUCHEVENTPIPE_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "stdatomic.h"
+
+/*******************************************************************************
+ * user inputs here
+ *******************************************************************************/
+/* set to 1 to scan/process on the sensing core (CM0+) and run event handlers on the application core (CM4) */
+#define TOUCH_PROCESSING_SPLIT_MODE		(0u)
+/* number of event records the pipe can hold (must be a power of 2) */
+#define TOUCH_EVENT_PIPE_DEPTH			(32u)
+/* records kept free for touchdown/lift-off ... hold and move records are refused once
+ * fewer than this many slots are left, so a backlog of on-going events can never cost a
+ * state transition (a lost lift-off would leave a handler stuck active). Size it for the
+ * transitions that can happen while the application core is behind (2 per widget) */
+#define TOUCH_EVENT_PIPE_RESERVE		(8u)
+
+#define TOUCH_EVENT_PIPE_MASK			(TOUCH_EVENT_PIPE_DEPTH - 1u)
+
+/* touchpad position packing in touchEventRecord_t.value */
+#define TOUCH_EVENT_XY(x, y)			((uint32_t)(x) | ((uint32_t)(y) << 16))
+#define TOUCH_EVENT_X(value)			((uint16_t)(value))
+#define TOUCH_EVENT_Y(value)			((uint16_t)((value) >> 16))
+
+/* event record sources */
+enum {
+	TOUCH_EVENT_SOURCE_BUTTONS = 0,
+	TOUCH_EVENT_SOURCE_SLIDERS,
+	TOUCH_EVENT_SOURCE_TOUCHPADS,
+	TOUCH_EVENT_SOURCE_MATRIX_BUTTONS
+};
+
+/* compact event record ... published by the sensing core, consumed by the application core */
+typedef struct
+{
+	uint8_t 	source;		/* TOUCH_EVENT_SOURCE_xxx */
+	uint8_t 	widget;		/* slider/touchpad/matrix number (unused for buttons) */
+	uint8_t 	eventType;	/* number of active buttons, active/lift-off, or touchpad finger event */
+	uint8_t 	newEvent;	/* touchdown/lift-off (1) or on-going (0) */
+	uint32_t 	value;		/* active button bitfield, slider position, matrix button number or touchpad x (low) / y (high) */
+	uint16_t 	z;			/* touchpad finger signal */
+	uint8_t 	id;			/* touchpad finger ID */
+	uint8_t 	reserved;
+} touchEventRecord_t;
+
+/* single-producer/single-consumer ring ... head written by producer only, tail by consumer only */
+typedef struct
+{
+	atomic_uint 		head;
+	atomic_uint 		tail;
+	uint32_t 			droppedEvents;	/* records rejected because the pipe was (nearly) full */
+	touchEventRecord_t 	records[TOUCH_EVENT_PIPE_DEPTH];
+} touchEventPipe_t;
+
+typedef void (*touchEventHandler_t)(const touchEventRecord_t *record);
+
+void touchEventPipe_Init(void);
+bool touchEventPipe_Connect(void);
+bool touchEventPipe_Publish(const touchEventRecord_t *record);
+bool touchEventPipe_Consume(touchEventRecord_t *record);
+uint32_t touchEventPipe_Dispatch(touchEventHandler_t handler);
+uint32_t touchEventPipe_GetDroppedEvents(void);
+
+/* transport port (touchEventPipe_ipc.c on PSoC 6, touchEventPipe_posix.c on Linux) */
+void touchEventPipePort_Advertise(touchEventPipe_t *pipe);
+touchEventPipe_t *touchEventPipePort_Connect(void);
+void touchEventPipePort_Notify(void);
+void touchEventPipePort_Wait(void);
+
+/* routes a record to processTouchEvents(), processSliderEvents() ... (implemented in main.c) */
+void dispatch_touch_event(const touchEventRecord_t *record);
+
+/* hands an event to its handler directly, or publishes it to the application core in split mode */
+static inline void touchEventPipe_Report(uint32_t source, uint32_t widget, uint32_t eventType, bool newEvent,
+		uint32_t value, uint16_t z, uint8_t id)
+{
+	touchEventRecord_t record =
+	{
+		.source = (uint8_t)source,
+		.widget = (uint8_t)widget,
+		.eventType = (uint8_t)eventType,
+		.newEvent = (uint8_t)newEvent,
+		.value = value,
+		.z = z,
+		.id = id
+	};
+
+#if (TOUCH_PROCESSING_SPLIT_MODE)
+	(void)touchEventPipe_Publish(&record); /* never block the sensing core ... overflow is counted in the pipe, holds/moves go first */
+#else
+	dispatch_touch_event(&record);
+#endif
+}
+
+
+#endif /* TOUCHEVENTPIPE_H_ */
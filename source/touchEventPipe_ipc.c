@@ -0,0 +1,91 @@
+/*
+ * touchEventPipe_ipc.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  PSoC 6 transport port for the touch event pipe.
+ *
+ *  Description: The sensing core (producer) writes the address of its ring into the
+ *  			 data register of a user IPC channel before it starts the application
+ *  			 core; the application core (consumer) reads it back on connect. IPC
+ *  			 registers sit at the same address for both cores, unlike symbols of the
+ *  			 two separately linked images.
+ *
+ *  			 After each published record the producer raises a notify event on a user
+ *  			 IPC interrupt structure. The consumer routes that IPC interrupt to a small
+ *  			 ISR which only sets a pending flag; touchEventPipePort_Wait() sleeps until
+ *  			 the flag is set.
+ *
+ *  			 No IPC lock is taken ... the ring in touchEventPipe.c is lock-free and
+ *  			 the IPC block is used purely as a mailbox and cross-core doorbell.
+ *
+ *  			 NOTE: not yet run on hardware (needs the dual-core project setup
+ *  			 described in main.c).
+ *
+ */
+
+#if !defined(__linux__)
+
+#include "cy_pdl.h"
+#include "touchEventPipe.h"
+
+#define TOUCH_EVENT_PIPE_IPC_CHAN		(CY_IPC_CHAN_USER)	/* data register carries the ring address, notify bit used as doorbell */
+#define TOUCH_EVENT_PIPE_IPC_INTR		(CY_IPC_INTR_USER)	/* IPC interrupt structure routed to the consumer */
+#define TOUCH_EVENT_PIPE_INTR_PRIORITY	(5u)				/* above tuner (EZI2C) and CapSense priorities */
+
+#define TOUCH_EVENT_PIPE_NOTIFY_MASK	(1uL << TOUCH_EVENT_PIPE_IPC_CHAN)
+
+static volatile bool notifyPending;
+
+static void touchEventPipePort_Isr(void)
+{
+	Cy_IPC_Drv_ClearInterrupt(Cy_IPC_Drv_GetIntrBaseAddr(TOUCH_EVENT_PIPE_IPC_INTR),
+			CY_IPC_NO_NOTIFICATION, TOUCH_EVENT_PIPE_NOTIFY_MASK);
+	notifyPending = true;
+}
+
+void touchEventPipePort_Advertise(touchEventPipe_t *pipe)
+{
+	Cy_IPC_Drv_WriteDataValue(Cy_IPC_Drv_GetIpcBaseAddress(TOUCH_EVENT_PIPE_IPC_CHAN), (uint32_t)pipe);
+}
+
+touchEventPipe_t *touchEventPipePort_Connect(void)
+{
+	static const cy_stc_sysint_t pipeIntrConfig =
+	{
+		.intrSrc = (IRQn_Type)(cpuss_interrupts_ipc_0_IRQn + TOUCH_EVENT_PIPE_IPC_INTR),
+		.intrPriority = TOUCH_EVENT_PIPE_INTR_PRIORITY,
+	};
+
+	notifyPending = false;
+
+	Cy_IPC_Drv_SetInterruptMask(Cy_IPC_Drv_GetIntrBaseAddr(TOUCH_EVENT_PIPE_IPC_INTR),
+			CY_IPC_NO_NOTIFICATION, TOUCH_EVENT_PIPE_NOTIFY_MASK);
+	(void)Cy_SysInt_Init(&pipeIntrConfig, &touchEventPipePort_Isr);
+	NVIC_ClearPendingIRQ(pipeIntrConfig.intrSrc);
+	NVIC_EnableIRQ(pipeIntrConfig.intrSrc);
+
+	/* data register resets to 0 ... NULL until the sensing core has advertised its ring */
+	return (touchEventPipe_t *)Cy_IPC_Drv_ReadDataValue(Cy_IPC_Drv_GetIpcBaseAddress(TOUCH_EVENT_PIPE_IPC_CHAN));
+}
+
+void touchEventPipePort_Notify(void)
+{
+	Cy_IPC_Drv_SetInterrupt(Cy_IPC_Drv_GetIntrBaseAddr(TOUCH_EVENT_PIPE_IPC_INTR),
+			CY_IPC_NO_NOTIFICATION, TOUCH_EVENT_PIPE_NOTIFY_MASK);
+}
+
+void touchEventPipePort_Wait(void)
+{
+	uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+
+	if(false == notifyPending) /* WFI still wakes on a pending IRQ with interrupts masked, so no notify is lost */
+	{
+		__WFI();
+	}
+	notifyPending = false;
+
+	Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+#endif /* !__linux__ */
@@ -0,0 +1,65 @@
+/*
+ * touchEventPipe_posix.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Linux transport port for the touch event pipe.
+ *
+ *  Description: Runs the sensing and application sides as two threads of one process.
+ *  			 The ring address is handed over in a mutex-protected variable;
+ *  			 notification is a pending flag protected by the same mutex and a condition
+ *  			 variable so a notify issued between touchEventPipe_Dispatch() and
+ *  			 touchEventPipePort_Wait() is never lost.
+ *
+ */
+
+#if defined(__linux__)
+
+#include <pthread.h>
+#include <stddef.h>
+#include "touchEventPipe.h"
+
+static pthread_mutex_t notifyMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t notifyCondition = PTHREAD_COND_INITIALIZER;
+static bool notifyPending;
+static touchEventPipe_t *advertisedPipe;
+
+void touchEventPipePort_Advertise(touchEventPipe_t *pipe)
+{
+	pthread_mutex_lock(&notifyMutex);
+	advertisedPipe = pipe;
+	pthread_mutex_unlock(&notifyMutex);
+}
+
+touchEventPipe_t *touchEventPipePort_Connect(void)
+{
+	touchEventPipe_t *pipe;
+
+	pthread_mutex_lock(&notifyMutex);
+	notifyPending = false;
+	pipe = advertisedPipe;
+	pthread_mutex_unlock(&notifyMutex);
+
+	return pipe;
+}
+
+void touchEventPipePort_Notify(void)
+{
+	pthread_mutex_lock(&notifyMutex);
+	notifyPending = true;
+	pthread_cond_signal(&notifyCondition);
+	pthread_mutex_unlock(&notifyMutex);
+}
+
+void touchEventPipePort_Wait(void)
+{
+	pthread_mutex_lock(&notifyMutex);
+	while(false == notifyPending)
+	{
+		pthread_cond_wait(&notifyCondition, &notifyMutex);
+	}
+	notifyPending = false;
+	pthread_mutex_unlock(&notifyMutex);
+}
+
+#endif /* __linux__ */
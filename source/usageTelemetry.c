@@ -0,0 +1,269 @@
+/*
+ * usageTelemetry.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Widget usage telemetry (RAM histograms with wear-leveled flash storage).
+ *
+ *  Description: This file collects how the widgets are actually used and keeps it
+ *  			 across resets:
+ *  			 	- touchdown, short hold, repeat and long hold counts per button
+ *  			 	- touch duration per button (log2 msec buckets - 1, 2-3, 4-7 ... msec)
+ *  			 	- slider position distribution (TELEMETRY_POSITION_BUCKETS equal slices)
+ *  			 	- touchdowns per matrix button key
+ *  			 	- touchpad touchdown positions (TELEMETRY_TOUCHPAD_GRID square cells) and
+ *  			 	  number of fingers down at each touchdown
+ *
+ *  			 Recording is O(1) per event (an index calculation and a saturating
+ *  			 increment) and never touches flash.
+ *
+ *  			 usageTelemetry_Service() is the deferred, low-priority path. When there is
+ *  			 new data and either TELEMETRY_FLUSH_INTERVAL_MSEC has passed or
+ *  			 TELEMETRY_FLUSH_EVENTS updates are pending, it snapshots the histograms into
+ *  			 a record and starts a non-blocking write to the next of TELEMETRY_FLASH_SLOTS
+ *  			 rows (round-robin, so each row wears 1/TELEMETRY_FLASH_SLOTS as fast). Each
+ *  			 record carries a sequence number and checksum; at startup the valid record
+ *  			 with the highest sequence is restored and writing continues after it. A
+ *  			 write interrupted by reset leaves the previous record intact.
+ *
+ *  			 The flash access is behind a small port:
+ *  			 	- usageTelemetry_flash.c - PSoC 6 emulated EEPROM flash region
+ *  			 	- usageTelemetry_file.c  - file-backed stand-in on Linux
+ *
+ *  Usage:
+ *  			- set USAGE_TELEMETRY_ENABLE (and limits) in usageTelemetry.h
+ *  			- call usageTelemetry_Init() once at startup
+ *  			- event processing records through the TELEMETRY_xxx() hooks in usageTelemetry.h
+ *  			  (on whichever core runs the event handlers)
+ *  			- call usageTelemetry_Service() from main loop while the CapSense hardware
+ *  			  is scanning, passing the time since the previous call (in split mode the
+ *  			  application core takes it from a HAL timer, see main.c)
+ *
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "usageTelemetry.h"
+
+#if !defined(__linux__)
+#include "cy_device_headers.h" /* CMSIS __CLZ */
+#endif
+
+usageHistograms_t usageHistograms;
+
+static usageTelemetryRecord_t flushRecord; /* must stay untouched while the port is writing it */
+static uint32_t nextSlot;
+static uint32_t nextSequence;
+static uint32_t pendingUpdates;
+static uint32_t msecSinceFlush;
+static bool flushInProgress;
+static uint32_t buttonTouchScans;
+static uint8_t touchpadFingersDown[TELEMETRY_MAX_TOUCHPADS];
+
+static uint32_t recordChecksum(const usageTelemetryRecord_t *record)
+{
+	const uint32_t *word = (const uint32_t *)record;
+	uint32_t sum1 = 0xFFFFu, sum2 = 0xFFFFu; /* Fletcher-style ... catches torn/erased rows */
+
+	for(uint32_t index = 0; index < (offsetof(usageTelemetryRecord_t, checksum) / sizeof(uint32_t)); index++)
+	{
+		sum1 = (sum1 + word[index]) % 0xFFFFu;
+		sum2 = (sum2 + sum1) % 0xFFFFu;
+	}
+
+	return (sum2 << 16) | sum1;
+}
+
+static uint32_t countLeadingZeros(uint32_t value)
+{
+#if defined(__linux__)
+	return (uint32_t)__builtin_clz(value); /* host build without CMSIS */
+#else
+	return (uint32_t)__CLZ(value);
+#endif
+}
+
+static void saturatingIncrement16(uint16_t *counter)
+{
+	if(*counter < UINT16_MAX)
+	{
+		(*counter)++;
+	}
+}
+
+void usageTelemetry_Init(void)
+{
+	bool found = false;
+
+	usageTelemetryPort_Init();
+
+	memset(&usageHistograms, 0, sizeof(usageHistograms));
+	nextSlot = 0;
+	nextSequence = 0;
+
+	/* restore newest valid record (sequence compared with wrap-around) */
+	for(uint32_t slot = 0; slot < TELEMETRY_FLASH_SLOTS; slot++)
+	{
+		if(usageTelemetryPort_Read(slot, &flushRecord)
+				&& TELEMETRY_RECORD_MAGIC == flushRecord.magic
+				&& recordChecksum(&flushRecord) == flushRecord.checksum
+				&& (false == found || (int32_t)(flushRecord.sequence - nextSequence) >= 0))
+		{
+			found = true;
+			usageHistograms = flushRecord.histograms;
+			nextSequence = flushRecord.sequence + 1u;
+			nextSlot = (slot + 1u) % TELEMETRY_FLASH_SLOTS;
+		}
+	}
+
+	pendingUpdates = 0;
+	msecSinceFlush = 0;
+	flushInProgress = false;
+}
+
+static void recordTouchDuration(uint32_t button, uint32_t durationMsec)
+{
+	uint32_t bucket = (0u == durationMsec) ? 0u : (32u - countLeadingZeros(durationMsec)); /* bit length = log2 bucket */
+
+	if(bucket >= TELEMETRY_DURATION_BUCKETS)
+	{
+		bucket = TELEMETRY_DURATION_BUCKETS - 1u;
+	}
+	saturatingIncrement16(&usageHistograms.touchDuration[button][bucket]);
+	pendingUpdates++;
+}
+
+/* arguments as passed to processTouchEvents() ... touchdown count and touch duration for single-key touches */
+void usageTelemetry_RecordButtonTouch(uint32_t numberActiveButtons, bool newEvent, uint32_t bitFieldActiveButtons, uint32_t scanMsec)
+{
+	uint32_t button;
+
+	if(0u == bitFieldActiveButtons || 0u != (bitFieldActiveButtons & (bitFieldActiveButtons - 1u))) /* not a single key */
+	{
+		return;
+	}
+	button = 31u - countLeadingZeros(bitFieldActiveButtons);
+	if(button >= TELEMETRY_MAX_BUTTONS)
+	{
+		return;
+	}
+
+	if(1u == numberActiveButtons) /* touchdown or hold (one event per scan) */
+	{
+		if(true == newEvent)
+		{
+			buttonTouchScans = 1;
+			usageTelemetry_RecordButtonEvent(button, TELEMETRY_TOUCHDOWN);
+		}
+		else
+		{
+			buttonTouchScans++;
+		}
+	}
+	else if(0u == numberActiveButtons) /* lift-off */
+	{
+		recordTouchDuration(button, buttonTouchScans * scanMsec);
+	}
+}
+
+void usageTelemetry_RecordButtonEvent(uint32_t button, uint32_t event)
+{
+	if(button < TELEMETRY_MAX_BUTTONS && event < TELEMETRY_NUMBER_BUTTON_EVENTS)
+	{
+		if(usageHistograms.buttonEvents[button][event] < UINT32_MAX)
+		{
+			usageHistograms.buttonEvents[button][event]++;
+		}
+		pendingUpdates++;
+	}
+}
+
+void usageTelemetry_RecordSliderPosition(uint32_t slider, uint32_t position, uint32_t resolution)
+{
+	if(slider < TELEMETRY_MAX_SLIDERS && resolution > 0u)
+	{
+		uint32_t bucket = (position * TELEMETRY_POSITION_BUCKETS) / (resolution + 1u);
+
+		if(bucket >= TELEMETRY_POSITION_BUCKETS)
+		{
+			bucket = TELEMETRY_POSITION_BUCKETS - 1u;
+		}
+		saturatingIncrement16(&usageHistograms.sliderPosition[slider][bucket]);
+		pendingUpdates++;
+	}
+}
+
+void usageTelemetry_RecordMatrixButton(uint32_t buttonNum)
+{
+	if(buttonNum < TELEMETRY_MAX_MATRIX_BUTTONS)
+	{
+		saturatingIncrement16(&usageHistograms.matrixButtonTouchdowns[buttonNum]);
+		pendingUpdates++;
+	}
+}
+
+/* called on each finger touchdown and lift-off ... position cell and fingers already down are counted at touchdown */
+void usageTelemetry_RecordTouchpadFinger(uint32_t touchpad, bool touchdown, uint32_t x, uint32_t y, uint32_t xResolution, uint32_t yResolution)
+{
+	if(touchpad >= TELEMETRY_MAX_TOUCHPADS)
+	{
+		return;
+	}
+
+	if(true == touchdown)
+	{
+		uint32_t column = (x * TELEMETRY_TOUCHPAD_GRID) / (xResolution + 1u);
+		uint32_t row = (y * TELEMETRY_TOUCHPAD_GRID) / (yResolution + 1u);
+
+		if(touchpadFingersDown[touchpad] < TELEMETRY_MAX_FINGERS)
+		{
+			touchpadFingersDown[touchpad]++;
+		}
+		column = (column < TELEMETRY_TOUCHPAD_GRID) ? column : TELEMETRY_TOUCHPAD_GRID - 1u;
+		row = (row < TELEMETRY_TOUCHPAD_GRID) ? row : TELEMETRY_TOUCHPAD_GRID - 1u;
+
+		saturatingIncrement16(&usageHistograms.touchpadTouchdowns[touchpad][row][column]);
+		saturatingIncrement16(&usageHistograms.touchpadFingers[touchpad][touchpadFingersDown[touchpad] - 1u]);
+		pendingUpdates++;
+	}
+	else if(touchpadFingersDown[touchpad] > 0u)
+	{
+		touchpadFingersDown[touchpad]--;
+	}
+}
+
+void usageTelemetry_Service(uint32_t elapsedMsec)
+{
+	if(msecSinceFlush < TELEMETRY_FLUSH_INTERVAL_MSEC)
+	{
+		msecSinceFlush += elapsedMsec;
+	}
+
+	if(true == flushInProgress) /* wait for previous write ... never block here */
+	{
+		if(usageTelemetryPort_IsBusy())
+		{
+			return;
+		}
+		flushInProgress = false;
+	}
+
+	if(0u == pendingUpdates || (msecSinceFlush < TELEMETRY_FLUSH_INTERVAL_MSEC && pendingUpdates < TELEMETRY_FLUSH_EVENTS))
+	{
+		return;
+	}
+
+	flushRecord.magic = TELEMETRY_RECORD_MAGIC;
+	flushRecord.sequence = nextSequence;
+	flushRecord.histograms = usageHistograms;
+	flushRecord.checksum = recordChecksum(&flushRecord);
+
+	if(usageTelemetryPort_StartWrite(nextSlot, &flushRecord))
+	{
+		flushInProgress = true;
+		nextSlot = (nextSlot + 1u) % TELEMETRY_FLASH_SLOTS;
+		nextSequence++;
+		pendingUpdates = 0;
+		msecSinceFlush = 0;
+	}
+}
@@ -0,0 +1,98 @@
+/*
+ * usageTelemetry.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef USAGETELEMETRY_H_
+#define USAGETELEMETRY_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+
+/*******************************************************************************
+ * user inputs here
+ *******************************************************************************/
+/* set to 1 to collect widget usage histograms and persist them to flash */
+#define USAGE_TELEMETRY_ENABLE			(0u)
+/* number of buttons, sliders, matrix button keys and touchpads tracked (index 0..n-1) */
+#define TELEMETRY_MAX_BUTTONS			(4u)
+#define TELEMETRY_MAX_SLIDERS			(2u)
+#define TELEMETRY_MAX_MATRIX_BUTTONS	(16u)
+#define TELEMETRY_MAX_TOUCHPADS			(1u)
+/* flush to flash when data changed and this much time has passed ... */
+#define TELEMETRY_FLUSH_INTERVAL_MSEC	(600000u)
+/* ... or when this many updates are pending (bounds data lost to a reset during heavy use) */
+#define TELEMETRY_FLUSH_EVENTS			(1000u)
+/* number of flash rows used round-robin for wear leveling */
+#define TELEMETRY_FLASH_SLOTS			(16u)
+
+#define TELEMETRY_DURATION_BUCKETS		(16u)	/* log2(msec) ... last bucket is >= 16 s */
+#define TELEMETRY_POSITION_BUCKETS		(16u)	/* equal-width slices of the slider */
+#define TELEMETRY_TOUCHPAD_GRID			(4u)	/* touchpad split into GRID x GRID cells */
+#define TELEMETRY_MAX_FINGERS			(4u)	/* fingers down at touchdown 1..n (more count as n) */
+#define TELEMETRY_RECORD_MAGIC			(0x54454C32u) /* "TEL2" ... "TEL1" records (no matrix/touchpad data) are ignored */
+
+/* button events counted by usageTelemetry_RecordButtonEvent() */
+enum {
+	TELEMETRY_TOUCHDOWN = 0,
+	TELEMETRY_SHORT_HOLD,
+	TELEMETRY_REPEAT,
+	TELEMETRY_LONG_HOLD,
+	TELEMETRY_NUMBER_BUTTON_EVENTS
+};
+
+/* histograms ... counters saturate instead of wrapping */
+typedef struct
+{
+	uint32_t 	buttonEvents[TELEMETRY_MAX_BUTTONS][TELEMETRY_NUMBER_BUTTON_EVENTS];
+	uint16_t 	touchDuration[TELEMETRY_MAX_BUTTONS][TELEMETRY_DURATION_BUCKETS];
+	uint16_t 	sliderPosition[TELEMETRY_MAX_SLIDERS][TELEMETRY_POSITION_BUCKETS];
+	uint16_t 	matrixButtonTouchdowns[TELEMETRY_MAX_MATRIX_BUTTONS];
+	uint16_t 	touchpadTouchdowns[TELEMETRY_MAX_TOUCHPADS][TELEMETRY_TOUCHPAD_GRID][TELEMETRY_TOUCHPAD_GRID];
+	uint16_t 	touchpadFingers[TELEMETRY_MAX_TOUCHPADS][TELEMETRY_MAX_FINGERS];
+} usageHistograms_t;
+
+/* flash record ... one per slot, newest valid sequence wins at startup */
+typedef struct
+{
+	uint32_t 			magic;
+	uint32_t 			sequence;
+	usageHistograms_t 	histograms;
+	uint32_t 			checksum;
+} usageTelemetryRecord_t;
+
+extern usageHistograms_t usageHistograms;
+
+void usageTelemetry_Init(void);
+void usageTelemetry_RecordButtonTouch(uint32_t numberActiveButtons, bool newEvent, uint32_t bitFieldActiveButtons, uint32_t scanMsec);
+void usageTelemetry_RecordButtonEvent(uint32_t button, uint32_t event);
+void usageTelemetry_RecordSliderPosition(uint32_t slider, uint32_t position, uint32_t resolution);
+void usageTelemetry_RecordMatrixButton(uint32_t buttonNum);
+void usageTelemetry_RecordTouchpadFinger(uint32_t touchpad, bool touchdown, uint32_t x, uint32_t y, uint32_t xResolution, uint32_t yResolution);
+void usageTelemetry_Service(uint32_t elapsedMsec);
+
+/* call-site hooks (the only way event processing records telemetry) ... compile to nothing when disabled */
+#if (USAGE_TELEMETRY_ENABLE)
+#define TELEMETRY_BUTTON_TOUCH(numberActive, newEvent, bitField)	usageTelemetry_RecordButtonTouch((numberActive), (newEvent), (bitField), TOUCH_COUNT_MSEC)
+#define TELEMETRY_BUTTON_EVENT(button, event)					usageTelemetry_RecordButtonEvent((button), (event))
+#define TELEMETRY_SLIDER_POSITION(slider, position, resolution)	usageTelemetry_RecordSliderPosition((slider), (position), (resolution))
+#define TELEMETRY_MATRIX_BUTTON(buttonNum)						usageTelemetry_RecordMatrixButton((buttonNum))
+#define TELEMETRY_TOUCHPAD_FINGER(touchpad, touchdown, x, y, xResolution, yResolution) \
+		usageTelemetry_RecordTouchpadFinger((touchpad), (touchdown), (x), (y), (xResolution), (yResolution))
+#else
+#define TELEMETRY_BUTTON_TOUCH(numberActive, newEvent, bitField)
+#define TELEMETRY_BUTTON_EVENT(button, event)
+#define TELEMETRY_SLIDER_POSITION(slider, position, resolution)
+#define TELEMETRY_MATRIX_BUTTON(buttonNum)
+#define TELEMETRY_TOUCHPAD_FINGER(touchpad, touchdown, x, y, xResolution, yResolution)
+#endif
+
+/* flash port (usageTelemetry_flash.c on PSoC 6, usageTelemetry_file.c on Linux) */
+void usageTelemetryPort_Init(void);
+bool usageTelemetryPort_Read(uint32_t slot, usageTelemetryRecord_t *record);
+bool usageTelemetryPort_StartWrite(uint32_t slot, const usageTelemetryRecord_t *record);
+bool usageTelemetryPort_IsBusy(void);
+
+
+#endif /* USAGETELEMETRY_H_ */
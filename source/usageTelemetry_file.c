@@ -0,0 +1,96 @@
+/*
+ * usageTelemetry_file.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Linux file-backed stand-in for the usage telemetry flash port.
+ *
+ *  Description: Emulates TELEMETRY_FLASH_SLOTS rows of TELEMETRY_HOST_ROW_SIZE bytes in
+ *  			 TELEMETRY_HOST_FILE. A missing file reads as erased rows. Writes complete
+ *  			 immediately (the port is never busy) and usageTelemetryHost_rowWrites[]
+ *  			 counts writes per row so wear leveling can be checked (see
+ *  			 host/usageTelemetry_test.c).
+ *
+ */
+
+#if defined(__linux__)
+
+#include <stdio.h>
+#include <string.h>
+#include "usageTelemetry.h"
+
+#define TELEMETRY_HOST_FILE				"usage_telemetry.bin"
+#define TELEMETRY_HOST_ROW_SIZE			(512u) /* same as PSoC 6 CY_FLASH_SIZEOF_ROW */
+
+_Static_assert(sizeof(usageTelemetryRecord_t) <= TELEMETRY_HOST_ROW_SIZE, "telemetry record must fit in one flash row");
+
+uint32_t usageTelemetryHost_rowWrites[TELEMETRY_FLASH_SLOTS];
+
+void usageTelemetryPort_Init(void)
+{
+	memset(usageTelemetryHost_rowWrites, 0, sizeof(usageTelemetryHost_rowWrites));
+}
+
+bool usageTelemetryPort_Read(uint32_t slot, usageTelemetryRecord_t *record)
+{
+	FILE *file;
+
+	if(slot >= TELEMETRY_FLASH_SLOTS)
+	{
+		return false;
+	}
+
+	memset(record, 0xFF, sizeof(*record)); /* erased flash */
+
+	file = fopen(TELEMETRY_HOST_FILE, "rb");
+	if(NULL != file)
+	{
+		if(0 == fseek(file, (long)(slot * TELEMETRY_HOST_ROW_SIZE), SEEK_SET))
+		{
+			(void)fread(record, 1, sizeof(*record), file); /* short read leaves the rest erased */
+		}
+		fclose(file);
+	}
+
+	return true;
+}
+
+bool usageTelemetryPort_StartWrite(uint32_t slot, const usageTelemetryRecord_t *record)
+{
+	uint8_t row[TELEMETRY_HOST_ROW_SIZE];
+	FILE *file;
+	bool status = false;
+
+	if(slot >= TELEMETRY_FLASH_SLOTS)
+	{
+		return false;
+	}
+
+	memset(row, 0xFF, sizeof(row));
+	memcpy(row, record, sizeof(*record));
+
+	file = fopen(TELEMETRY_HOST_FILE, "r+b");
+	if(NULL == file)
+	{
+		file = fopen(TELEMETRY_HOST_FILE, "w+b"); /* first write creates the "flash" */
+	}
+	if(NULL != file)
+	{
+		if(0 == fseek(file, (long)(slot * TELEMETRY_HOST_ROW_SIZE), SEEK_SET)
+				&& sizeof(row) == fwrite(row, 1, sizeof(row), file))
+		{
+			usageTelemetryHost_rowWrites[slot]++;
+			status = true;
+		}
+		fclose(file);
+	}
+
+	return status;
+}
+
+bool usageTelemetryPort_IsBusy(void)
+{
+	return false;
+}
+
+#endif /* __linux__ */
@@ -0,0 +1,66 @@
+/*
+ * usageTelemetry_flash.c
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  PSoC 6 flash port for usage telemetry.
+ *
+ *  Description: Records live in TELEMETRY_FLASH_SLOTS rows of the emulated EEPROM
+ *  			 flash region (.cy_em_eeprom), one record per row. Writes use
+ *  			 Cy_Flash_StartWrite(), which returns immediately; the main loop polls
+ *  			 usageTelemetryPort_IsBusy() instead of waiting for the erase/program cycle.
+ *
+ */
+
+#if !defined(__linux__)
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "usageTelemetry.h"
+
+_Static_assert(sizeof(usageTelemetryRecord_t) <= CY_FLASH_SIZEOF_ROW, "telemetry record must fit in one flash row");
+
+CY_SECTION(".cy_em_eeprom") CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+static const volatile uint8_t telemetryFlash[TELEMETRY_FLASH_SLOTS][CY_FLASH_SIZEOF_ROW] = {{0u}};
+
+static uint32_t rowBuffer[CY_FLASH_SIZEOF_ROW / sizeof(uint32_t)]; /* must stay untouched while the row is being written */
+
+void usageTelemetryPort_Init(void)
+{
+	/* nothing to do ... flash driver is ready after cybsp_init() */
+}
+
+bool usageTelemetryPort_Read(uint32_t slot, usageTelemetryRecord_t *record)
+{
+	if(slot >= TELEMETRY_FLASH_SLOTS)
+	{
+		return false;
+	}
+
+	for(uint32_t index = 0; index < sizeof(*record); index++) /* volatile ... contents change behind the compiler's back */
+	{
+		((uint8_t *)record)[index] = telemetryFlash[slot][index];
+	}
+
+	return true;
+}
+
+bool usageTelemetryPort_StartWrite(uint32_t slot, const usageTelemetryRecord_t *record)
+{
+	if(slot >= TELEMETRY_FLASH_SLOTS)
+	{
+		return false;
+	}
+
+	memset(rowBuffer, 0xFF, sizeof(rowBuffer));
+	memcpy(rowBuffer, record, sizeof(*record));
+
+	return (CY_FLASH_DRV_OPERATION_STARTED == Cy_Flash_StartWrite((uint32_t)telemetryFlash[slot], rowBuffer));
+}
+
+bool usageTelemetryPort_IsBusy(void)
+{
+	return (CY_FLASH_DRV_OPCODE_BUSY == Cy_Flash_IsOperationComplete());
+}
+
+#endif /* !__linux__ */